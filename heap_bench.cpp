@@ -0,0 +1,82 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 19:40:16
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 20:12:48
+ * @FilePath     : /heap_bench.cpp
+ * @Description  : 比较不同子节点数的堆在 PQType 和 heapSort 上的耗时。
+ *                 编译：g++ -O2 -std=c++17 -Iinclude heap_bench.cpp -o heap_bench
+ *                 运行：./heap_bench [最大元素个数，默认 10000000]，元素个数从 1K 开始每次乘 10，完整对比可传入 100000000
+ */
+#include "PQType.hpp"
+#include "sort.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+// 写入计算结果，防止被测代码被整个优化掉
+volatile std::uint64_t sink{0};
+
+template <typename Function>
+double measureMs(Function func) {
+    auto start{std::chrono::steady_clock::now()};
+    func();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<std::uint64_t> randomElements(std::size_t size) {
+    std::mt19937_64 random{size};
+    std::vector<std::uint64_t> elements(size);
+    for (auto &e : elements) {
+        e = random();
+    }
+    return elements;
+}
+
+template <std::size_t Arity>
+double benchQueue(const std::vector<std::uint64_t> &elements) {
+    std::uint64_t checksum{0};
+    double ms{measureMs([&]() {
+        dsa::PQType<std::uint64_t, Arity> queue{};
+        for (auto e : elements) {
+            queue.enqueue(e);
+        }
+        while (!queue.isEmpty()) {
+            checksum ^= queue.dequeue();
+        }
+    })};
+    sink = checksum;
+    return ms;
+}
+
+template <std::size_t Arity>
+double benchHeapSort(const std::vector<std::uint64_t> &elements) {
+    std::vector<std::uint64_t> copy{elements};
+    double ms{measureMs([&]() { dsa::heapSort<Arity>(copy.begin(), copy.end()); })};
+    sink = copy.front();
+    return ms;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    std::size_t maxSize{argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000};
+
+    std::cout << std::setw(12) << "size" << std::setw(14) << "pq<2> ms" << std::setw(14) << "pq<4> ms" << std::setw(14) << "pq<8> ms"
+              << std::setw(14) << "sort<2> ms" << std::setw(14) << "sort<4> ms" << std::setw(14) << "sort<8> ms" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (std::size_t size = 1000; size <= maxSize; size *= 10) {
+        auto elements{randomElements(size)};
+        std::cout << std::setw(12) << size
+                  << std::setw(14) << benchQueue<2>(elements) << std::setw(14) << benchQueue<4>(elements) << std::setw(14) << benchQueue<8>(elements)
+                  << std::setw(14) << benchHeapSort<2>(elements) << std::setw(14) << benchHeapSort<4>(elements) << std::setw(14) << benchHeapSort<8>(elements)
+                  << std::endl;
+    }
+    return 0;
+}
@@ -1,7 +1,14 @@
 #ifndef __ARRAY_LIST_H__
 #define __ARRAY_LIST_H__
 
-#include "AbstractList.hpp"
+#include "ArrayListStats.hpp"
+#include "ArrayStorage.hpp"
+#include "BoundsCheckPolicy.hpp"
+#include "GrowthPolicy.hpp"
+#include "StaticList.hpp"
+#include "format.hpp"
+#include "simd_search.hpp"
+#include "utility.hpp"
 #include <algorithm>
 #include <functional>
 #include <iterator>
@@ -10,6 +17,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <type_traits>
 
 #ifdef DEBUG
 #include <cassert>
@@ -22,53 +30,70 @@ namespace dsa {
  * @Author       : sphc
  * @Date         : 2023-10-18 13:32:32
  * @LastEditors  : sphc
- * @LastEditTime : 2023-10-21 13:45:49
+ * @LastEditTime : 2026-10-20 14:36:52
  * @FilePath     : /include/ArrayList.hpp
- * @Description  : List 集合数组实现
+ * @Description  : List 集合数组实现，通过 StaticList 静态分派，需要虚接口时使用 ListAdapter<ArrayList<...>>；
+ *                 BoundsCheck 决定 get/set/add/remove 等方法的索引检查方式，见 BoundsCheckPolicy.hpp；
+ *                 定义 DSA_ARRAY_LIST_STATS 后记录扩容、缩容统计，见 ArrayListStats.hpp
  */
-template <typename ElementType>
-class ArrayList final : public AbstractList<ElementType> {
+template <typename ElementType, typename Allocator = std::allocator<ElementType>, typename GrowthPolicy = DefaultGrowthPolicy, typename BoundsCheck = DefaultBoundsCheck>
+class ArrayList final : public StaticList<ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>, BoundsCheck>,
+                        public __detail::__ArrayStorage<ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>, ElementType, Allocator> {
 public:
-    using size_type = typename AbstractList<ElementType>::size_type;
-
-    ArrayList(size_type capacity = __DEFAULT_CAPACITY);
-    ArrayList(const ElementType &) = delete;
-    ArrayList(ElementType &&) = delete;
-    ArrayList &operator=(const ElementType &) = delete;
-    ArrayList &operator=(ElementType &&) = delete;
-    ~ArrayList() override;
+    using size_type = typename StaticList<ArrayList, BoundsCheck>::size_type;
+    using value_type = ElementType;
+    using allocator_type = Allocator;
+    using iterator = ContiguousIterator<ElementType, ArrayList>;
+    using const_iterator = ContiguousIterator<const ElementType, ArrayList>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    ArrayList(size_type capacity = GrowthPolicy::MIN_CAPACITY, const Allocator &allocator = Allocator{});
+    explicit ArrayList(const Allocator &allocator);
+    ArrayList(const ArrayList &) = delete;
+    ArrayList(ArrayList &&rhs) noexcept;
+    ArrayList &operator=(const ArrayList &) = delete;
+    ArrayList &operator=(ArrayList &&rhs);
+    ~ArrayList();
 
     /**
      * @description: 清除集合中的所有元素
      * @return      {void}
      */
-    void clear() override;
+    void clear();
 
     /**
      * @description: 获取集合中元素数量
      * @return      {size_type} 集合中元素的数量
      */
-    [[nodiscard]] size_type size() const override;
+    [[nodiscard]] size_type size() const;
 
     /**
      * @description: 检查集合是否有元素
      * @return      {bool} 无元素返回 true，有元素返回 false
      */
-    [[nodiscard]] bool isEmpty() const override;
+    [[nodiscard]] bool isEmpty() const;
 
     /**
      * @description: 查找元素是否出现在集合中
      * @param       {const ElementType &} element 需要查找的元素
      * @return      {bool} 存在返回 true，不存在返回 false
      */
-    [[nodiscard]] bool contains(const ElementType &element) const override;
+    [[nodiscard]] bool contains(const ElementType &element) const;
 
     /**
      * @description: 往集合末尾插入元素
      * @param       {const ElementType &} element 需要插入的元素
      * @return      {void}
      */
-    void add(const ElementType &element) override;
+    void add(const ElementType &element);
+
+    /**
+     * @description: 往集合末尾插入元素，元素以移动方式放入集合
+     * @param       {ElementType &&} element 需要插入的元素
+     * @return      {void}
+     */
+    void add(ElementType &&element);
 
     /**
      * @description: 在集合指定位置处插入元素
@@ -76,14 +101,30 @@ public:
      * @param       {ElementType} &element 要插入的元素
      * @return      {void}
      */
-    void add(size_type index, const ElementType &element) override;
+    void add(size_type index, const ElementType &element);
+
+    /**
+     * @description: 在集合指定位置处插入元素，元素以移动方式放入集合
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {ElementType &&} element 要插入的元素
+     * @return      {void}
+     */
+    void add(size_type index, ElementType &&element);
 
     /**
      * @description: 获取集合指定位置处的元素
      * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
      * @return      {const ElementType &} 指定位置处的元素
      */
-    [[nodiscard]] const ElementType &get(size_type index) const override;
+    [[nodiscard]] const ElementType &get(size_type index) const;
+
+    /**
+     * @description: 不做索引检查地访问集合指定位置处的元素，调用方保证 index < size()，operator[] 等价于该方法
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] ElementType &getUnchecked(size_type index) noexcept;
+    [[nodiscard]] const ElementType &getUnchecked(size_type index) const noexcept;
 
     /**
      * @description: 将集合指定位置处的元素设置为指定元素
@@ -91,28 +132,36 @@ public:
      * @param       {const ElementType &} element 要设置的元素
      * @return      {ElementType} 设置之前的元素
      */
-    ElementType set(size_type index, const ElementType &element) override;
+    ElementType set(size_type index, const ElementType &element);
+
+    /**
+     * @description: 将集合指定位置处的元素设置为指定元素，元素以移动方式放入集合
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @param       {ElementType &&} element 要设置的元素
+     * @return      {ElementType} 设置之前的元素
+     */
+    ElementType set(size_type index, ElementType &&element);
 
     /**
      * @description: 删除集合指定位置处的元素
      * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
      * @return      {ElementType} 被删除的元素
      */
-    ElementType remove(size_type index) override;
+    ElementType remove(size_type index);
 
     /**
      * @description: 在集合中获取指定元素的位置索引
      * @param       {ElementType} &element 指定元素
      * @return      {size_type} 指定元素所在的位置索引，未找到则返回 ArrayList<ElementType>::npos
      */
-    [[nodiscard]] size_type indexOf(const ElementType &element) const override;
+    [[nodiscard]] size_type indexOf(const ElementType &element) const;
 
     /**
      * @description: 将集合转换为字符串表示，可用于打印等
      * @param       {function<void(ElementType &)>} toString 将集合中元素转换为字符串的方法
      * @return      {string} 集合的字符串表示
      */
-    [[nodiscard]] std::string toString(std::function<std::string(const ElementType &)> toString) const override;
+    [[nodiscard]] std::string toString(std::function<std::string(const ElementType &)> toString) const;
 
     // 新增方法
     /**
@@ -121,478 +170,669 @@ public:
      */
     [[nodiscard]] size_type capacity() const;
 
+    /**
+     * @description: 获取集合使用的分配器
+     * @return      {Allocator} 分配器的副本
+     */
+    [[nodiscard]] Allocator getAllocator() const;
+
+    /**
+     * @description: 在集合中获取指定元素最后一次出现的位置索引
+     * @param       {const ElementType &} element 指定元素
+     * @return      {size_type} 指定元素最后一次出现的位置索引，未找到则返回 ArrayList<ElementType>::npos
+     */
+    [[nodiscard]] size_type lastIndexOf(const ElementType &element) const;
+
+    /**
+     * @description: 统计指定元素在集合中出现的次数
+     * @param       {const ElementType &} element 指定元素
+     * @return      {size_type} 出现次数
+     */
+    [[nodiscard]] size_type count(const ElementType &element) const;
+
+    /**
+     * @description: 预留至少能容纳 capacity 个元素的空间，之后自动缩容不会低于该容量
+     * @param       {size_type} capacity 需要预留的容量
+     * @return      {void}
+     */
+    void reserve(size_type capacity);
+
+    /**
+     * @description: 将容量缩小到刚好容纳现有元素（不低于扩容策略的最小容量），同时取消 reserve 设置的容量下限
+     * @return      {void}
+     */
+    void shrinkToFit();
+
+    /**
+     * @description: 用参数在集合指定位置处直接构造元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {Args &&...} args 元素构造参数
+     * @return      {ElementType &} 新构造的元素
+     */
+    template <typename... Args>
+    ElementType &emplace(size_type index, Args &&...args);
+
+    /**
+     * @description: 用参数在集合末尾直接构造元素
+     * @param       {Args &&...} args 元素构造参数
+     * @return      {ElementType &} 新构造的元素
+     */
+    template <typename... Args>
+    ElementType &emplaceBack(Args &&...args);
+
+    /**
+     * @description: 将 [first, last) 中的元素依次追加到集合末尾，范围不能来自集合自身
+     * @param       {InputIterator} first 范围起始
+     * @param       {InputIterator} last 范围末尾
+     * @return      {void}
+     */
+    template <typename InputIterator>
+    void addAll(InputIterator first, InputIterator last);
+
+    /**
+     * @description: 在集合指定位置处插入 [first, last) 中的元素，范围不能来自集合自身。
+     *               前向迭代器最多只移动一次尾部元素、最多扩容一次；单遍输入迭代器先追加到末尾再整体旋转到位
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {InputIterator} first 范围起始
+     * @param       {InputIterator} last 范围末尾
+     * @return      {void}
+     */
+    template <typename InputIterator>
+    void insertRange(size_type index, InputIterator first, InputIterator last);
+
+    /**
+     * @description: 删除集合中 [from, to) 范围内的元素，只移动一次尾部元素、最多缩容一次
+     * @param       {size_type} from 范围起始索引
+     * @param       {size_type} to 范围末尾索引，要求 from <= to <= size()
+     * @return      {void}
+     */
+    void removeRange(size_type from, size_type to);
+
+    /**
+     * @description: 删除集合中所有满足条件的元素，剩余元素保持原有顺序，整个过程只压缩一遍、最多缩容一次
+     * @param       {Predicate} pred 判断元素是否需要删除的谓词
+     * @return      {size_type} 被删除的元素数量
+     */
+    template <typename Predicate>
+    size_type removeIf(Predicate pred);
+
+    /**
+     * @description: 获取底层连续存储的首地址，[data(), data() + size()) 为有效元素
+     * @return      {ElementType *} 首元素地址，集合被移走后可能为 nullptr
+     */
+    ElementType *data() noexcept;
+    const ElementType *data() const noexcept;
+
+    /**
+     * @description: 获取覆盖全部元素的连续视图，集合发生扩容、缩容或移动后视图失效
+     * @return      {Span} 元素视图
+     */
+    Span<ElementType> span() noexcept;
+    Span<const ElementType> span() const noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+    reverse_iterator rbegin() noexcept;
+    reverse_iterator rend() noexcept;
+    const_reverse_iterator rbegin() const noexcept;
+    const_reverse_iterator rend() const noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+#ifdef DSA_ARRAY_LIST_STATS
+    /**
+     * @description: 获取本实例的扩容、缩容统计，集合被移动时统计随内存一起转移
+     * @return      {const ArrayListStats &} 实例统计
+     */
+    [[nodiscard]] const ArrayListStats &stats() const noexcept;
+#endif
+
 private:
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename AllocatorTraits::value_type, ElementType>, "Allocator::value_type must be ElementType");
+
+    Allocator __allocator;
     ElementType *__data;
     size_type __size;
     size_type __capacity;
+    // reserve 设置的容量下限，自动缩容不会低于该值
+    size_type __reservedCapacity;
+#ifdef DSA_ARRAY_LIST_STATS
+    ArrayListStats __stats;
+#endif
 
-    using Allocator = std::allocator<ElementType>;
-    using AllocatorTraits = std::allocator_traits<Allocator>;
-    inline static Allocator __allocator{};
-    inline static constexpr size_type __DEFAULT_CAPACITY{10};
-
-    using __ListOperation = typename AbstractList<ElementType>::_Operation;
-
+    using __Base = StaticList<ArrayList, BoundsCheck>;
+    using __ListOperation = typename __Base::_Operation;
+    using __Storage = __detail::__ArrayStorage<ArrayList, ElementType, Allocator>;
+    friend __Storage;
+    using __Storage::_closeGap;
+    using __Storage::_destroyRange;
+    using __Storage::_emplaceAt;
+    using __Storage::_openGap;
+    using __Storage::_relocateTo;
+
+    template <typename ForwardIterator>
+    void __insertRange(size_type index, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
+    template <typename InputIterator>
+    void __insertRange(size_type index, InputIterator first, InputIterator last, std::input_iterator_tag);
     void __reallocToFitNewCapacity(size_type newCapacity);
+    /**
+     * @description: 记录一次内存分配，未定义 DSA_ARRAY_LIST_STATS 时为空函数
+     * @param       {size_type} oldCapacity 分配前的容量，首次分配为 0
+     * @param       {size_type} newCapacity 分配后的容量
+     * @param       {size_type} moved 重定位的元素个数
+     * @return      {void}
+     */
+    void __recordRealloc(size_type oldCapacity, size_type newCapacity, size_type moved) noexcept;
+    /**
+     * @description: 按扩容策略计算容纳 needCapacity 个元素所需的新容量
+     * @return      {size_type} 扩容后的容量
+     */
+    size_type __grownCapacity(size_type needCapacity) const;
+    /**
+     * @description: 释放旧内存并换上已经容纳全部元素的新内存 newData
+     * @return      {void}
+     */
+    void __replaceBuffer(ElementType *newData, size_type newCapacity) noexcept;
     void __ensureCapacity(size_type needCapacity);
     void __shrinkIfNecessary();
     void __destroyAllElement();
     static size_type __initCapacity(size_type capacity);
+};
 
-    class iterator;
-    iterator begin();
-    iterator end();
-    class const_iterator;
-    const_iterator cbegin() const;
-    const_iterator cend() const;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::ArrayList(size_type capacity, const Allocator &allocator) :
+    __allocator{allocator}, __data{AllocatorTraits::allocate(__allocator, __initCapacity(capacity))}, __size{0}, __capacity{__initCapacity(capacity)}, __reservedCapacity{0} {
+    __recordRealloc(0, __capacity, 0);
+}
 
-    class reverse_iterator;
-    reverse_iterator rbegin();
-    reverse_iterator rend();
-};
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::ArrayList(const Allocator &allocator) :
+    ArrayList(GrowthPolicy::MIN_CAPACITY, allocator) {
+}
 
-template <typename ElementType>
-ArrayList<ElementType>::ArrayList(size_type capacity) :
-    __data{AllocatorTraits::allocate(__allocator, __initCapacity(capacity))}, __size{0}, __capacity{__initCapacity(capacity)} {
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::ArrayList(ArrayList &&rhs) noexcept :
+    __allocator{std::move(rhs.__allocator)}, __data{std::exchange(rhs.__data, nullptr)}, __size{std::exchange(rhs.__size, 0)}, __capacity{std::exchange(rhs.__capacity, 0)}, __reservedCapacity{std::exchange(rhs.__reservedCapacity, 0)} {
+#ifdef DSA_ARRAY_LIST_STATS
+    __stats = std::exchange(rhs.__stats, ArrayListStats{});
+#endif
 }
 
-template <typename ElementType>
-ArrayList<ElementType>::~ArrayList() {
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck> &ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::operator=(ArrayList &&rhs) {
+    if (this == &rhs) {
+        return *this;
+    }
+    if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value && !AllocatorTraits::is_always_equal::value) {
+        // 分配器不传播且不相等时不能接管对方的内存，只能逐个移动元素
+        if (__allocator != rhs.__allocator) {
+            clear();
+            if (__capacity < rhs.__size) {
+                __reallocToFitNewCapacity(rhs.__size);
+            }
+            for (ElementType &element : rhs) {
+                AllocatorTraits::construct(__allocator, __data + __size, std::move(element));
+                ++__size;
+            }
+            rhs.clear();
+            __reservedCapacity = rhs.__reservedCapacity;
+            return *this;
+        }
+    }
     __destroyAllElement();
-    AllocatorTraits::deallocate(__allocator, __data, __capacity);
+    if (__data != nullptr) {
+        AllocatorTraits::deallocate(__allocator, __data, __capacity);
+    }
+    if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+        __allocator = std::move(rhs.__allocator);
+    }
+    __data = std::exchange(rhs.__data, nullptr);
+    __size = std::exchange(rhs.__size, 0);
+    __capacity = std::exchange(rhs.__capacity, 0);
+    __reservedCapacity = std::exchange(rhs.__reservedCapacity, 0);
+#ifdef DSA_ARRAY_LIST_STATS
+    __stats = std::exchange(rhs.__stats, ArrayListStats{});
+#endif
+    return *this;
+}
+
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::~ArrayList() {
+    __destroyAllElement();
+    if (__data != nullptr) {
+        AllocatorTraits::deallocate(__allocator, __data, __capacity);
+    }
 }
 
 // checked
-template <typename ElementType>
-void ArrayList<ElementType>::clear() {
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::clear() {
     __destroyAllElement();
     __size = 0;
 }
 
-template <typename ElementType>
-[[nodiscard]] typename ArrayList<ElementType>::size_type ArrayList<ElementType>::size() const {
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::size_type ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::size() const {
     return __size;
 }
 
-template <typename ElementType>
-[[nodiscard]] typename ArrayList<ElementType>::size_type ArrayList<ElementType>::capacity() const {
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::size_type ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::capacity() const {
     return __capacity;
 }
 
-template <typename ElementType>
-[[nodiscard]] bool ArrayList<ElementType>::isEmpty() const {
-    return size() == 0;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] Allocator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::getAllocator() const {
+    return __allocator;
 }
 
-template <typename ElementType>
-[[nodiscard]] bool ArrayList<ElementType>::contains(const ElementType &element) const {
-    return std::find(cbegin(), cend(), element) != cend();
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::reserve(size_type capacity) {
+    if (capacity > __capacity) {
+        __reallocToFitNewCapacity(capacity);
+    }
+    __reservedCapacity = std::max(__reservedCapacity, capacity);
 }
 
-template <typename ElementType>
-void ArrayList<ElementType>::add(const ElementType &element) {
-    add(__size, element);
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::shrinkToFit() {
+    __reservedCapacity = 0;
+    size_type newCapacity{std::max(__size, GrowthPolicy::MIN_CAPACITY)};
+    if (newCapacity < __capacity) {
+        __reallocToFitNewCapacity(newCapacity);
+    }
 }
 
-template <typename ElementType>
-[[nodiscard]] const ElementType &ArrayList<ElementType>::get(size_type index) const {
-    AbstractList<ElementType>::template _checkIndex<__ListOperation::GET>(index, size());
-    return __data[index];
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] bool ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::isEmpty() const {
+    return size() == 0;
 }
 
-template <typename ElementType>
-ElementType ArrayList<ElementType>::set(size_type index, const ElementType &element) {
-    AbstractList<ElementType>::template _checkIndex<__ListOperation::SET>(index, size());
-    ElementType old{std::move(__data[index])};
-    __data[index] = element;
-    return old;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] bool ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::contains(const ElementType &element) const {
+    return indexOf(element) != __Base::npos;
 }
 
-template <typename ElementType>
-void ArrayList<ElementType>::add(size_type index, const ElementType &element) {
-    AbstractList<ElementType>::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, size());
-    __ensureCapacity(size() + 1);
-    // 这种情况无需移动元素，直接在尾部构造
-    if (index == size()) {
-        AllocatorTraits::construct(__allocator, __data + __size++, element);
-        return;
-    }
-    AllocatorTraits::construct(__allocator, __data + __size, __data[__size - 1]);
-    // auto it {std::move(rbegin() + 1, rend() - index, rbegin())};
-    auto it{std::move_backward(begin() + index, end() - 1, end())};
-    *it = element;
-    ++__size;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::add(const ElementType &element) {
+    _emplaceAt(__size, element);
 }
 
-template <typename ElementType>
-ElementType ArrayList<ElementType>::remove(size_type index) {
-    AbstractList<ElementType>::template _checkIndex<__ListOperation::REMOVE>(index, size());
-    ElementType old{std::move(__data[index])};
-    std::move(begin() + index + 1, end(), begin() + index);
-    AllocatorTraits::destroy(__allocator, __data + __size--);
-    __shrinkIfNecessary();
-    return old;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::add(ElementType &&element) {
+    _emplaceAt(__size, std::move(element));
 }
 
-template <typename ElementType>
-[[nodiscard]] typename ArrayList<ElementType>::size_type ArrayList<ElementType>::indexOf(const ElementType &element) const {
-    auto it{std::find(cbegin(), cend(), element)};
-    return it != cend() ? it - cbegin() : AbstractList<ElementType>::npos;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] const ElementType &ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::get(size_type index) const {
+    __Base::template _checkIndex<__ListOperation::GET>(index, size());
+    return __data[index];
 }
 
-template <typename ElementType>
-[[nodiscard]] std::string ArrayList<ElementType>::toString(std::function<std::string(const ElementType &)> toString) const {
-    std::ostringstream sstream{};
-    sstream << "[";
-    std::for_each(cbegin(), cend(), [&sstream, &toString](const auto &e) { sstream << toString(e) << ", "; });
-    std::string result{sstream.str()};
-    if (result.size() > 1) {
-        result.pop_back();
-        result.pop_back();
-    }
-    result += "]";
-    return result;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] ElementType &ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::getUnchecked(size_type index) noexcept {
+#ifdef DEBUG
+    assert(index < __size);
+#endif
+    return __data[index];
 }
 
-template <typename ElementType>
-void ArrayList<ElementType>::__reallocToFitNewCapacity(size_type newCapacity) {
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] const ElementType &ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::getUnchecked(size_type index) const noexcept {
 #ifdef DEBUG
-    std::cout << "__reallocToFitNewCapacity() [newCapacity = " << newCapacity << ", __capacity = " << __capacity << ", __size = " << __size << "]." << std::endl;
-    assert(__size <= newCapacity);
+    assert(index < __size);
 #endif
-    auto newData{AllocatorTraits::allocate(__allocator, newCapacity)};
-    std::uninitialized_move(begin(), end(), newData);
-    __destroyAllElement();
-    AllocatorTraits::deallocate(__allocator, __data, __capacity);
-    __data = newData;
-    __capacity = newCapacity;
+    return __data[index];
 }
 
-template <typename ElementType>
-void ArrayList<ElementType>::__ensureCapacity(size_type needCapacity) {
-    if (needCapacity > __capacity) {
-        __reallocToFitNewCapacity(__capacity << 1);
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ElementType ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::set(size_type index, const ElementType &element) {
+    __Base::template _checkIndex<__ListOperation::SET>(index, size());
+    // element 可能就是 __data[index]，先拷贝再替换
+    ElementType old{element};
+    std::swap(old, __data[index]);
+    return old;
 }
 
-template <typename ElementType>
-void ArrayList<ElementType>::__shrinkIfNecessary() {
-    if (__size < __capacity >> 2) {
-        __reallocToFitNewCapacity(__capacity >> 2);
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ElementType ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::set(size_type index, ElementType &&element) {
+    __Base::template _checkIndex<__ListOperation::SET>(index, size());
+    ElementType old{std::move(__data[index])};
+    __data[index] = std::move(element);
+    return old;
 }
 
-template <typename ElementType>
-void ArrayList<ElementType>::__destroyAllElement() {
-    std::for_each(begin(), end(), [](auto &obj) {
-        AllocatorTraits::destroy(__allocator, &obj);
-    });
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::add(size_type index, const ElementType &element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, size());
+    _emplaceAt(index, element);
 }
 
-template <typename ElementType>
-typename ArrayList<ElementType>::size_type ArrayList<ElementType>::__initCapacity(size_type capacity) {
-    return capacity < __DEFAULT_CAPACITY ? __DEFAULT_CAPACITY : capacity;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::add(size_type index, ElementType &&element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, size());
+    _emplaceAt(index, std::move(element));
 }
 
-template <typename ElementType>
-class ArrayList<ElementType>::iterator {
-public:
-    // iterator traits
-    using difference_type = typename std::allocator<ElementType>::difference_type;
-    using value_type = ElementType;
-    using pointer = value_type *;
-    using reference = value_type &;
-    using iterator_category = std::bidirectional_iterator_tag;
-
-    iterator(pointer pos) :
-        __cur{pos} {
-    }
-    iterator(const iterator &rhs) :
-        __cur{rhs.__cur} {
-    }
-    iterator(iterator &&rhs) :
-        __cur{rhs.__cur} {
-    }
-    iterator &operator=(const iterator &rhs) {
-        __cur = rhs.__cur;
-    }
-    iterator &operator=(iterator &&rhs) {
-        __cur = rhs.__cur;
-    }
-
-    iterator operator+(size_type step) const {
-        return iterator{__cur + step};
-    }
-
-    iterator &operator+=(size_type step) {
-        __cur += step;
-        return *this;
-    }
-
-    iterator operator-(size_type step) const {
-        return iterator{__cur - step};
-    }
-
-    iterator &operator-=(size_type step) {
-        __cur -= step;
-        return *this;
-    }
-
-    difference_type operator-(iterator rhs) const {
-        return __cur - rhs.__cur;
-    }
-
-    iterator &operator++() {
-        ++__cur;
-        return *this;
-    }
-
-    iterator &operator--() {
-        --__cur;
-        return *this;
-    }
-
-    iterator operator++(int _) {
-        pointer old = __cur;
-        ++__cur;
-        return iterator{old};
-    }
-
-    iterator operator--(int _) {
-        pointer old = __cur;
-        --__cur;
-        return iterator{old};
-    }
-
-    reference operator*() const {
-        return *__cur;
-    }
-
-    pointer operator->() const {
-        return __cur;
-    }
-
-    bool operator==(iterator rhs) const {
-        return __cur == rhs.__cur;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+template <typename... Args>
+ElementType &ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::emplace(size_type index, Args &&...args) {
+    __Base::template _checkIndex<__ListOperation::EMPLACE>(index, size());
+    return _emplaceAt(index, std::forward<Args>(args)...);
+}
 
-    bool operator!=(iterator rhs) const {
-        return !(*this == rhs);
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+template <typename... Args>
+ElementType &ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::emplaceBack(Args &&...args) {
+    return _emplaceAt(__size, std::forward<Args>(args)...);
+}
 
-private:
-    pointer __cur;
-};
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+template <typename InputIterator>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::addAll(InputIterator first, InputIterator last) {
+    __insertRange(__size, first, last, typename std::iterator_traits<InputIterator>::iterator_category{});
+}
 
-template <typename ElementType>
-class ArrayList<ElementType>::const_iterator {
-public:
-    // iterator traits
-    using difference_type = typename std::allocator<ElementType>::difference_type;
-    using value_type = ElementType;
-    using pointer = const value_type *;
-    using reference = const value_type &;
-    using iterator_category = std::bidirectional_iterator_tag;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+template <typename InputIterator>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::insertRange(size_type index, InputIterator first, InputIterator last) {
+    __Base::template _checkIndex<__ListOperation::INSERT_RANGE>(index, size());
+    __insertRange(index, first, last, typename std::iterator_traits<InputIterator>::iterator_category{});
+}
 
-    const_iterator(pointer pos) :
-        __cur{pos} {
-    }
-    const_iterator(const const_iterator &rhs) :
-        __cur{rhs.__cur} {
-    }
-    const_iterator(const_iterator &&rhs) :
-        __cur{rhs.__cur} {
-    }
-    const_iterator &operator=(const const_iterator &rhs) {
-        __cur = rhs.__cur;
-    }
-    const_iterator &operator=(const_iterator &&rhs) {
-        __cur = rhs.__cur;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::removeRange(size_type from, size_type to) {
+    __Base::template _checkRange<__ListOperation::REMOVE_RANGE>(from, to, size());
+    if (from == to) {
+        return;
     }
+    _destroyRange(__data + from, __data + to);
+    _closeGap(from, to - from);
+    __shrinkIfNecessary();
+}
 
-    const_iterator operator+(size_type step) const {
-        return iterator{__cur + step};
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+template <typename Predicate>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::size_type ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::removeIf(Predicate pred) {
+    ElementType *newEnd{std::remove_if(__data, __data + __size, pred)};
+    size_type removed = __data + __size - newEnd;
+    _destroyRange(newEnd, __data + __size);
+    __size -= removed;
+    __shrinkIfNecessary();
+    return removed;
+}
 
-    const_iterator &operator+=(size_type step) {
-        __cur += step;
-        return *this;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ElementType ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::remove(size_type index) {
+    __Base::template _checkIndex<__ListOperation::REMOVE>(index, size());
+    ElementType old{std::move(__data[index])};
+    AllocatorTraits::destroy(__allocator, __data + index);
+    _closeGap(index);
+    __shrinkIfNecessary();
+    return old;
+}
 
-    const_iterator operator-(size_type step) const {
-        return iterator{__cur - step};
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::size_type ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::indexOf(const ElementType &element) const {
+    if constexpr (simd::is_searchable_v<ElementType>) {
+        size_type index{simd::findFirst(__data, __size, element)};
+        return index != __size ? index : __Base::npos;
+    } else {
+        auto it{std::find(cbegin(), cend(), element)};
+        return it != cend() ? it - cbegin() : __Base::npos;
     }
+}
 
-    const_iterator &operator-=(size_type step) {
-        __cur -= step;
-        return *this;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::size_type ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::lastIndexOf(const ElementType &element) const {
+    if constexpr (simd::is_searchable_v<ElementType>) {
+        size_type index{simd::findLast(__data, __size, element)};
+        return index != __size ? index : __Base::npos;
+    } else {
+        for (size_type index{__size}; index > 0; --index) {
+            if (__data[index - 1] == element) {
+                return index - 1;
+            }
+        }
+        return __Base::npos;
     }
+}
 
-    difference_type operator-(const_iterator rhs) const {
-        return __cur - rhs.__cur;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::size_type ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::count(const ElementType &element) const {
+    if constexpr (simd::is_searchable_v<ElementType>) {
+        return simd::count(__data, __size, element);
+    } else {
+        return std::count(cbegin(), cend(), element);
     }
+}
 
-    const_iterator &operator++() {
-        ++__cur;
-        return *this;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] std::string ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::toString(std::function<std::string(const ElementType &)> toString) const {
+    std::string result{};
+    __Base::formatTo(std::back_inserter(result), ToStringFormatter{std::move(toString)});
+    return result;
+}
 
-    const_iterator &operator--() {
-        --__cur;
-        return *this;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+template <typename ForwardIterator>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::__insertRange(size_type index, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+    auto count{static_cast<size_type>(std::distance(first, last))};
+    if (count == 0) {
+        return;
     }
-
-    const_iterator operator++(int _) {
-        pointer old = __cur;
-        ++__cur;
-        return iterator{old};
+    if (__size + count <= __capacity) {
+        _openGap(index, count);
+        ElementType *cur{__data + index};
+        try {
+            for (; first != last; ++first, ++cur) {
+                AllocatorTraits::construct(__allocator, cur, *first);
+            }
+        } catch (...) {
+            _destroyRange(__data + index, cur);
+            _closeGap(index, count);
+            throw;
+        }
+        return;
     }
+    // 容量不足时直接在新内存中构造新元素，旧元素只重定位一次
+    size_type newCapacity{__grownCapacity(__size + count)};
+    auto newData{AllocatorTraits::allocate(__allocator, newCapacity)};
+    ElementType *cur{newData + index};
+    try {
+        for (; first != last; ++first, ++cur) {
+            AllocatorTraits::construct(__allocator, cur, *first);
+        }
+        _relocateTo(newData, index, count);
+    } catch (...) {
+        _destroyRange(newData + index, cur);
+        AllocatorTraits::deallocate(__allocator, newData, newCapacity);
+        throw;
+    }
+    __replaceBuffer(newData, newCapacity);
+    __size += count;
+}
 
-    const_iterator operator--(int _) {
-        pointer old = __cur;
-        --__cur;
-        return iterator{old};
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+template <typename InputIterator>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::__insertRange(size_type index, InputIterator first, InputIterator last, std::input_iterator_tag) {
+    // 单遍迭代器无法预先得知元素数量，先追加到末尾再旋转到指定位置
+    size_type oldSize{__size};
+    try {
+        for (; first != last; ++first) {
+            _emplaceAt(__size, *first);
+        }
+    } catch (...) {
+        _destroyRange(__data + oldSize, __data + __size);
+        __size = oldSize;
+        throw;
+    }
+    std::rotate(__data + index, __data + oldSize, __data + __size);
+}
 
-    reference operator*() const {
-        return *__cur;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::__reallocToFitNewCapacity(size_type newCapacity) {
+#ifdef DEBUG
+    std::cout << "__reallocToFitNewCapacity() [newCapacity = " << newCapacity << ", __capacity = " << __capacity << ", __size = " << __size << "]." << std::endl;
+    assert(__size <= newCapacity);
+#endif
+    auto newData{AllocatorTraits::allocate(__allocator, newCapacity)};
+    try {
+        _relocateTo(newData);
+    } catch (...) {
+        AllocatorTraits::deallocate(__allocator, newData, newCapacity);
+        throw;
     }
+    __replaceBuffer(newData, newCapacity);
+}
 
-    pointer operator->() const {
-        return __cur;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::__recordRealloc([[maybe_unused]] size_type oldCapacity, [[maybe_unused]] size_type newCapacity, [[maybe_unused]] size_type moved) noexcept {
+#ifdef DSA_ARRAY_LIST_STATS
+    __detail::__recordArrayListRealloc(oldCapacity, newCapacity, sizeof(ElementType), moved, __stats);
+#endif
+}
 
-    bool operator==(const_iterator rhs) const {
-        return __cur == rhs.__cur;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::size_type ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::__grownCapacity(size_type needCapacity) const {
+    return GrowthPolicy::grow(__capacity, needCapacity);
+}
 
-    bool operator!=(const_iterator rhs) const {
-        return !(*this == rhs);
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::__replaceBuffer(ElementType *newData, size_type newCapacity) noexcept {
+    __recordRealloc(__capacity, newCapacity, __size);
+    if (__data != nullptr) {
+        AllocatorTraits::deallocate(__allocator, __data, __capacity);
     }
+    __data = newData;
+    __capacity = newCapacity;
+}
 
-private:
-    pointer __cur;
-};
-
-template <typename ElementType>
-class ArrayList<ElementType>::reverse_iterator {
-public:
-    // iterator traits
-    using difference_type = typename std::allocator<ElementType>::difference_type;
-    using value_type = ElementType;
-    using pointer = ElementType *;
-    using reference = ElementType &;
-    using iterator_category = std::bidirectional_iterator_tag;
-
-    reverse_iterator(pointer pos) :
-        __cur{pos} {
-    }
-    reverse_iterator(const reverse_iterator &rhs) :
-        __cur{rhs.__cur} {
-    }
-    reverse_iterator(reverse_iterator &&rhs) :
-        __cur{rhs.__cur} {
-    }
-    reverse_iterator &operator=(const reverse_iterator &rhs) {
-        __cur = rhs.__cur;
-    }
-    reverse_iterator &operator=(reverse_iterator &&rhs) {
-        __cur = rhs.cur;
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::__ensureCapacity(size_type needCapacity) {
+    if (needCapacity > __capacity) {
+        __reallocToFitNewCapacity(__grownCapacity(needCapacity));
     }
+}
 
-    reverse_iterator operator+(size_type step) {
-        return reverse_iterator{__cur - step};
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::__shrinkIfNecessary() {
+    if (GrowthPolicy::shouldShrink(__size, __capacity)) {
+        size_type newCapacity{std::max(GrowthPolicy::shrink(__size), __reservedCapacity)};
+        if (newCapacity < __capacity) {
+            __reallocToFitNewCapacity(newCapacity);
+        }
     }
+}
 
-    reverse_iterator &operator+=(size_type step) {
-        __cur -= step;
-        return *this;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::__destroyAllElement() {
+    _destroyRange(__data, __data + __size);
+}
 
-    reverse_iterator operator-(size_type step) {
-        return reverse_iterator{__cur + step};
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::size_type ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::__initCapacity(size_type capacity) {
+    return std::max(capacity, GrowthPolicy::MIN_CAPACITY);
+}
 
-    reverse_iterator &operator-=(size_type step) {
-        __cur += step;
-        return *this;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ElementType *ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::data() noexcept {
+    return __data;
+}
 
-    difference_type operator-(reverse_iterator rhs) {
-        return rhs.__cur - __cur;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+const ElementType *ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::data() const noexcept {
+    return __data;
+}
 
-    reverse_iterator &operator++() {
-        --__cur;
-        return *this;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+Span<ElementType> ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::span() noexcept {
+    return Span<ElementType>{__data, __size};
+}
 
-    reverse_iterator &operator--() {
-        ++__cur;
-        return *this;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+Span<const ElementType> ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::span() const noexcept {
+    return Span<const ElementType>{__data, __size};
+}
 
-    reverse_iterator operator++(int _) {
-        pointer old = __cur;
-        --__cur;
-        return reverse_iterator{old};
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::begin() noexcept {
+    return iterator{__data};
+}
 
-    reverse_iterator operator--(int _) {
-        pointer old = __cur;
-        ++__cur;
-        return reverse_iterator{old};
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::end() noexcept {
+    return iterator{__data + __size};
+}
 
-    reference operator*() {
-        return *(__cur - 1);
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::const_iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::begin() const noexcept {
+    return const_iterator{__data};
+}
 
-    pointer operator->() {
-        return __cur - 1;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::const_iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::end() const noexcept {
+    return const_iterator{__data + __size};
+}
 
-    bool operator==(reverse_iterator rhs) {
-        return __cur == rhs.__cur;
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::const_iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::cbegin() const noexcept {
+    return begin();
+}
 
-    bool operator!=(reverse_iterator rhs) {
-        return !(*this == rhs);
-    }
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::const_iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::cend() const noexcept {
+    return end();
+}
 
-private:
-    pointer __cur;
-};
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::reverse_iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
 
-template <typename ElementType>
-typename ArrayList<ElementType>::iterator ArrayList<ElementType>::begin() {
-    return iterator{__data};
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::reverse_iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::rend() noexcept {
+    return reverse_iterator{begin()};
 }
 
-template <typename ElementType>
-typename ArrayList<ElementType>::iterator ArrayList<ElementType>::end() {
-    return iterator{__data + __size};
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::const_reverse_iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::rbegin() const noexcept {
+    return const_reverse_iterator{end()};
 }
 
-template <typename ElementType>
-typename ArrayList<ElementType>::const_iterator ArrayList<ElementType>::cbegin() const {
-    return const_iterator{__data};
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::const_reverse_iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::rend() const noexcept {
+    return const_reverse_iterator{begin()};
 }
 
-template <typename ElementType>
-typename ArrayList<ElementType>::const_iterator ArrayList<ElementType>::cend() const {
-    return const_iterator{__data + __size};
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::const_reverse_iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::crbegin() const noexcept {
+    return rbegin();
 }
 
-template <typename ElementType>
-typename ArrayList<ElementType>::reverse_iterator ArrayList<ElementType>::rbegin() {
-    return reverse_iterator{__data + __size};
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::const_reverse_iterator ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::crend() const noexcept {
+    return rend();
 }
 
-template <typename ElementType>
-typename ArrayList<ElementType>::reverse_iterator ArrayList<ElementType>::rend() {
-    return reverse_iterator{__data};
+#ifdef DSA_ARRAY_LIST_STATS
+template <typename ElementType, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] const ArrayListStats &ArrayList<ElementType, Allocator, GrowthPolicy, BoundsCheck>::stats() const noexcept {
+    return __stats;
 }
+#endif
+
+namespace pmr {
+
+template <typename ElementType, typename GrowthPolicy = DefaultGrowthPolicy, typename BoundsCheck = DefaultBoundsCheck>
+using ArrayList = dsa::ArrayList<ElementType, std::pmr::polymorphic_allocator<ElementType>, GrowthPolicy, BoundsCheck>;
+
+} // namespace pmr
 
 } // namespace dsa
 
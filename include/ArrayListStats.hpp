@@ -0,0 +1,63 @@
+#ifndef __ARRAY_LIST_STATS_H__
+#define __ARRAY_LIST_STATS_H__
+
+#include <cstddef>
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 16:30:12
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 16:30:12
+ * @FilePath     : /include/ArrayListStats.hpp
+ * @Description  : ArrayList 的内存分配统计。只有在编译时定义 DSA_ARRAY_LIST_STATS 后 ArrayList 才会记录，
+ *                 未定义时 ArrayList 不包含统计成员，记录函数为空，没有任何开销。
+ *                 该宏改变 ArrayList 的内存布局，必须对整个程序统一定义（例如通过 -DDSA_ARRAY_LIST_STATS）
+ */
+struct ArrayListStats {
+    using size_type = std::size_t;
+
+    // 扩容次数（不含构造时的首次分配）
+    size_type growCount{0};
+    // 缩容次数，包括自动缩容和 shrinkToFit
+    size_type shrinkCount{0};
+    // 累计分配的字节数，包括构造时的首次分配
+    size_type bytesAllocated{0};
+    // 扩容、缩容时重定位的元素个数
+    size_type elementsMoved{0};
+    // 容量的峰值
+    size_type peakCapacity{0};
+};
+
+/**
+ * @description: 获取进程内所有 ArrayList 的累计统计，peakCapacity 为所有实例中的最大值。
+ *               各字段分别原子读取，并发修改时各字段之间不保证一致
+ * @return      {ArrayListStats} 累计统计
+ */
+ArrayListStats globalArrayListStats() noexcept;
+
+/**
+ * @description: 将全局累计统计清零
+ * @return      {void}
+ */
+void resetGlobalArrayListStats() noexcept;
+
+namespace __detail {
+
+/**
+ * @description: 记录一次分配，由 ArrayList 调用
+ * @param       {size_type} oldCapacity 分配前的容量，首次分配为 0
+ * @param       {size_type} newCapacity 分配后的容量
+ * @param       {size_type} elementSize 元素大小
+ * @param       {size_type} moved 重定位的元素个数
+ * @param       {ArrayListStats &} stats 实例统计
+ * @return      {void}
+ */
+void __recordArrayListRealloc(std::size_t oldCapacity, std::size_t newCapacity, std::size_t elementSize, std::size_t moved, ArrayListStats &stats) noexcept;
+
+} // namespace __detail
+
+} // namespace dsa
+
+#endif
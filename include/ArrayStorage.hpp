@@ -0,0 +1,274 @@
+#ifndef __ARRAY_STORAGE_H__
+#define __ARRAY_STORAGE_H__
+
+#include "utility.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#ifdef DEBUG
+#include <cassert>
+#endif
+
+namespace dsa {
+
+namespace __detail {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-20 14:36:52
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-20 14:36:52
+ * @FilePath     : /include/ArrayStorage.hpp
+ * @Description  : 连续存储容器共用的元素搬移逻辑（CRTP 基类）：重定位到新内存、开合空位以及容量不足时的插入。
+ *                 Derived 需要将本类声明为友元，并提供成员 __allocator、__data、__size、__capacity，以及
+ *                 __grownCapacity(needCapacity) 计算扩容后的容量、__replaceBuffer(newData, newCapacity) 释放旧内存并换上新内存
+ */
+template <typename Derived, typename ElementType, typename Allocator>
+class __ArrayStorage {
+protected:
+    // 可平凡重定位的元素直接按字节搬移，搬移后无需析构原位置；分配器自定义了 construct/destroy 时不能绕过它
+    inline static constexpr bool _BITWISE_RELOCATABLE{is_trivially_relocatable_v<ElementType> && allocator_has_trivial_construct_v<Allocator>};
+
+    __ArrayStorage() = default;
+    __ArrayStorage(const __ArrayStorage &) = default;
+    __ArrayStorage(__ArrayStorage &&) = default;
+    __ArrayStorage &operator=(const __ArrayStorage &) = default;
+    __ArrayStorage &operator=(__ArrayStorage &&) = default;
+    ~__ArrayStorage() = default;
+
+    /**
+     * @description: 将全部元素重定位到新内存 newData，[index, index + gap) 留给调用者构造新元素。
+     *               移动构造可能抛出异常的元素改为复制，全部构造成功后才析构旧元素，
+     *               中途抛出异常时只清理 newData 中已构造的元素，集合保持不变
+     * @param       {ElementType} *newData 新内存，要求 size() + gap 不超过其容量
+     * @param       {size_type} index 空位起始索引
+     * @param       {size_type} gap 空位数量
+     * @return      {void}
+     */
+    void _relocateTo(ElementType *newData, std::size_t index = 0, std::size_t gap = 0);
+    /**
+     * @description: 将 [index, size()) 的元素整体后移 count 位，[index, index + count) 留下未初始化的空位，size() 增加 count
+     * @param       {size_type} index 空位起始索引，要求 size() + count <= capacity()
+     * @param       {size_type} count 空位数量
+     * @return      {void}
+     */
+    void _openGap(std::size_t index, std::size_t count = 1);
+    /**
+     * @description: _openGap 的逆操作，[index, index + count) 为未初始化的空位，将其后的元素整体前移 count 位，size() 减少 count
+     * @param       {size_type} index 空位起始索引
+     * @param       {size_type} count 空位数量
+     * @return      {void}
+     */
+    void _closeGap(std::size_t index, std::size_t count = 1);
+    /**
+     * @description: 不检查索引，在 index 处构造元素
+     * @return      {ElementType &} 新构造的元素
+     */
+    template <typename... Args>
+    ElementType &_emplaceAt(std::size_t index, Args &&...args);
+    /**
+     * @description: 集合已满时插入元素：先在新内存中构造新元素，再把旧元素重定位到其两侧，
+     *               构造参数引用集合内部的元素也是安全的
+     * @return      {void}
+     */
+    template <typename... Args>
+    void _reallocInsert(std::size_t index, Args &&...args);
+    void _destroyRange(ElementType *first, ElementType *last);
+    /**
+     * @description: 通过分配器将 [first, last) 中的元素移动构造到 dest 开始的未初始化内存
+     * @return      {void}
+     */
+    void _uninitializedMove(ElementType *first, ElementType *last, ElementType *dest);
+    /**
+     * @description: 同 _uninitializedMove，但移动构造可能抛出异常且元素可复制时改为复制构造，抛出异常时 [first, last) 不受影响
+     * @return      {void}
+     */
+    void _uninitializedMoveIfNoexcept(ElementType *first, ElementType *last, ElementType *dest);
+
+private:
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    Derived &__self() noexcept;
+};
+
+template <typename Derived, typename ElementType, typename Allocator>
+void __ArrayStorage<Derived, ElementType, Allocator>::_relocateTo(ElementType *newData, std::size_t index, std::size_t gap) {
+    Derived &self{__self()};
+    if constexpr (_BITWISE_RELOCATABLE) {
+        if (index != 0) {
+            std::memcpy(static_cast<void *>(newData), static_cast<const void *>(self.__data), index * sizeof(ElementType));
+        }
+        if (index != self.__size) {
+            std::memcpy(static_cast<void *>(newData + index + gap), static_cast<const void *>(self.__data + index), (self.__size - index) * sizeof(ElementType));
+        }
+    } else {
+        _uninitializedMoveIfNoexcept(self.__data, self.__data + index, newData);
+        try {
+            _uninitializedMoveIfNoexcept(self.__data + index, self.__data + self.__size, newData + index + gap);
+        } catch (...) {
+            _destroyRange(newData, newData + index);
+            throw;
+        }
+        // 提交点：新内存中的元素全部构造完毕后才析构旧元素
+        _destroyRange(self.__data, self.__data + self.__size);
+    }
+}
+
+template <typename Derived, typename ElementType, typename Allocator>
+void __ArrayStorage<Derived, ElementType, Allocator>::_openGap(std::size_t index, std::size_t count) {
+    Derived &self{__self()};
+#ifdef DEBUG
+    assert(index <= self.__size && self.__size + count <= self.__capacity);
+#endif
+    ElementType *pos{self.__data + index};
+    ElementType *oldEnd{self.__data + self.__size};
+    if constexpr (_BITWISE_RELOCATABLE) {
+        std::memmove(static_cast<void *>(pos + count), static_cast<const void *>(pos), (self.__size - index) * sizeof(ElementType));
+    } else if (count >= self.__size - index) {
+        // 尾部元素全部落在未初始化的区域
+        _uninitializedMove(pos, oldEnd, pos + count);
+        _destroyRange(pos, oldEnd);
+    } else {
+        _uninitializedMove(oldEnd - count, oldEnd, oldEnd);
+        try {
+            std::move_backward(pos, oldEnd - count, oldEnd);
+        } catch (...) {
+            _destroyRange(oldEnd, oldEnd + count);
+            throw;
+        }
+        _destroyRange(pos, pos + count);
+    }
+    self.__size += count;
+}
+
+template <typename Derived, typename ElementType, typename Allocator>
+void __ArrayStorage<Derived, ElementType, Allocator>::_closeGap(std::size_t index, std::size_t count) {
+    Derived &self{__self()};
+#ifdef DEBUG
+    assert(index + count <= self.__size);
+#endif
+    ElementType *pos{self.__data + index};
+    ElementType *src{pos + count};
+    ElementType *oldEnd{self.__data + self.__size};
+    if constexpr (_BITWISE_RELOCATABLE) {
+        std::memmove(static_cast<void *>(pos), static_cast<const void *>(src), (oldEnd - src) * sizeof(ElementType));
+    } else {
+        // 尾部元素全部落在空位中时只需移动构造
+        bool tailInGap{static_cast<std::size_t>(oldEnd - src) <= count};
+        try {
+            _uninitializedMove(src, tailInGap ? oldEnd : src + count, pos);
+        } catch (...) {
+            // 空位无法填补，丢弃其后的元素使集合保持有效
+            _destroyRange(src, oldEnd);
+            self.__size = index;
+            throw;
+        }
+        if (tailInGap) {
+            _destroyRange(src, oldEnd);
+        } else {
+            std::move(src + count, oldEnd, src);
+            _destroyRange(oldEnd - count, oldEnd);
+        }
+    }
+    self.__size -= count;
+}
+
+template <typename Derived, typename ElementType, typename Allocator>
+template <typename... Args>
+ElementType &__ArrayStorage<Derived, ElementType, Allocator>::_emplaceAt(std::size_t index, Args &&...args) {
+    Derived &self{__self()};
+    if (self.__size == self.__capacity) {
+        _reallocInsert(index, std::forward<Args>(args)...);
+    } else if (index == self.__size) {
+        // 这种情况无需移动元素，直接在尾部构造
+        AllocatorTraits::construct(self.__allocator, self.__data + self.__size, std::forward<Args>(args)...);
+        ++self.__size;
+    } else {
+        // 参数可能引用集合内部的元素，移动元素前先构造出来
+        ElementType value(std::forward<Args>(args)...);
+        _openGap(index);
+        try {
+            AllocatorTraits::construct(self.__allocator, self.__data + index, std::move(value));
+        } catch (...) {
+            _closeGap(index);
+            throw;
+        }
+    }
+    return self.__data[index];
+}
+
+template <typename Derived, typename ElementType, typename Allocator>
+template <typename... Args>
+void __ArrayStorage<Derived, ElementType, Allocator>::_reallocInsert(std::size_t index, Args &&...args) {
+    Derived &self{__self()};
+    std::size_t newCapacity{self.__grownCapacity(self.__size + 1)};
+    auto newData{AllocatorTraits::allocate(self.__allocator, newCapacity)};
+    try {
+        AllocatorTraits::construct(self.__allocator, newData + index, std::forward<Args>(args)...);
+    } catch (...) {
+        AllocatorTraits::deallocate(self.__allocator, newData, newCapacity);
+        throw;
+    }
+    try {
+        _relocateTo(newData, index, 1);
+    } catch (...) {
+        AllocatorTraits::destroy(self.__allocator, newData + index);
+        AllocatorTraits::deallocate(self.__allocator, newData, newCapacity);
+        throw;
+    }
+    self.__replaceBuffer(newData, newCapacity);
+    ++self.__size;
+}
+
+template <typename Derived, typename ElementType, typename Allocator>
+void __ArrayStorage<Derived, ElementType, Allocator>::_destroyRange(ElementType *first, ElementType *last) {
+    if constexpr (!std::is_trivially_destructible_v<ElementType> || !allocator_has_trivial_construct_v<Allocator>) {
+        Derived &self{__self()};
+        std::for_each(first, last, [&self](auto &obj) {
+            AllocatorTraits::destroy(self.__allocator, &obj);
+        });
+    }
+}
+
+template <typename Derived, typename ElementType, typename Allocator>
+void __ArrayStorage<Derived, ElementType, Allocator>::_uninitializedMove(ElementType *first, ElementType *last, ElementType *dest) {
+    Derived &self{__self()};
+    ElementType *cur{dest};
+    try {
+        for (; first != last; ++first, ++cur) {
+            AllocatorTraits::construct(self.__allocator, cur, std::move(*first));
+        }
+    } catch (...) {
+        _destroyRange(dest, cur);
+        throw;
+    }
+}
+
+template <typename Derived, typename ElementType, typename Allocator>
+void __ArrayStorage<Derived, ElementType, Allocator>::_uninitializedMoveIfNoexcept(ElementType *first, ElementType *last, ElementType *dest) {
+    Derived &self{__self()};
+    ElementType *cur{dest};
+    try {
+        for (; first != last; ++first, ++cur) {
+            AllocatorTraits::construct(self.__allocator, cur, std::move_if_noexcept(*first));
+        }
+    } catch (...) {
+        _destroyRange(dest, cur);
+        throw;
+    }
+}
+
+template <typename Derived, typename ElementType, typename Allocator>
+Derived &__ArrayStorage<Derived, ElementType, Allocator>::__self() noexcept {
+    return static_cast<Derived &>(*this);
+}
+
+} // namespace __detail
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef __BOUNDS_CHECK_POLICY_H__
+#define __BOUNDS_CHECK_POLICY_H__
+
+#include "ListIndexChecker.hpp"
+
+#ifdef DEBUG
+#include <cassert>
+#endif
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 23:14:26
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 23:14:26
+ * @FilePath     : /include/BoundsCheckPolicy.hpp
+ * @Description  : List 索引检查策略，作为集合的模板参数在编译期选择：
+ *                 BoundsChecked 越界时抛出 std::out_of_range（默认）；
+ *                 BoundsDebugAssert 只在定义了 DEBUG 时用 assert 检查，否则不产生任何代码；
+ *                 BoundsUnchecked 完全不检查
+ */
+struct BoundsChecked {
+    using size_type = ListIndexChecker::size_type;
+    using Operation = ListIndexChecker::Operation;
+
+    template <Operation Op>
+    static void checkIndex(size_type index, size_type size) {
+        ListIndexChecker::checkIndex<Op>(index, size);
+    }
+
+    template <Operation Op>
+    static void checkRange(size_type from, size_type to, size_type size) {
+        ListIndexChecker::checkRange<Op>(from, to, size);
+    }
+};
+
+struct BoundsDebugAssert {
+    using size_type = ListIndexChecker::size_type;
+    using Operation = ListIndexChecker::Operation;
+
+    template <Operation Op>
+    static void checkIndex([[maybe_unused]] size_type index, [[maybe_unused]] size_type size) noexcept {
+#ifdef DEBUG
+        assert((ListIndexChecker::isValidIndex<Op>(index, size)));
+#endif
+    }
+
+    template <Operation Op>
+    static void checkRange([[maybe_unused]] size_type from, [[maybe_unused]] size_type to, [[maybe_unused]] size_type size) noexcept {
+#ifdef DEBUG
+        assert(ListIndexChecker::isValidRange(from, to, size));
+#endif
+    }
+};
+
+struct BoundsUnchecked {
+    using size_type = ListIndexChecker::size_type;
+    using Operation = ListIndexChecker::Operation;
+
+    template <Operation Op>
+    static constexpr void checkIndex(size_type, size_type) noexcept {
+    }
+
+    template <Operation Op>
+    static constexpr void checkRange(size_type, size_type, size_type) noexcept {
+    }
+};
+
+using DefaultBoundsCheck = BoundsChecked;
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,414 @@
+#ifndef __CONCURRENT_ARRAY_LIST_H__
+#define __CONCURRENT_ARRAY_LIST_H__
+
+#include "ListIndexChecker.hpp"
+#include "format.hpp"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 19:41:06
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-21 09:12:40
+ * @FilePath     : /include/ConcurrentArrayList.hpp
+ * @Description  : 只追加的无锁并发集合。存储由容量按 2 倍递增的分段组成，分段一旦分配就不再移动，
+ *                 因此元素地址在集合生命周期内保持稳定。
+ *                 追加：先确保槽位所在的分段已安装（不存在时用 CAS 安装），再用 CAS 领取槽位，构造完成后标记槽位就绪并推进已发布的 size；
+ *                 读取：get(index) 只做一次 size 的 acquire 读取和定位计算，无等待。
+ *                 只有已发布（size() 以内）的元素对读者可见
+ */
+template <typename ElementType, typename Allocator = std::allocator<ElementType>>
+class ConcurrentArrayList {
+public:
+    using size_type = ListIndexChecker::size_type;
+    using value_type = ElementType;
+    using allocator_type = Allocator;
+    inline static constexpr size_type npos{std::numeric_limits<size_type>::max()};
+
+    explicit ConcurrentArrayList(const Allocator &allocator = Allocator{}) noexcept;
+    ConcurrentArrayList(const ConcurrentArrayList &) = delete;
+    ConcurrentArrayList &operator=(const ConcurrentArrayList &) = delete;
+    ~ConcurrentArrayList();
+
+    /**
+     * @description: 获取集合中已发布的元素数量
+     * @return      {size_type} 已发布元素的数量
+     */
+    [[nodiscard]] size_type size() const noexcept;
+
+    /**
+     * @description: 检查集合是否有已发布的元素
+     * @return      {bool} 无元素返回 true，有元素返回 false
+     */
+    [[nodiscard]] bool isEmpty() const noexcept;
+
+    /**
+     * @description: 查找元素是否出现在已发布的元素中
+     * @param       {const ElementType &} element 需要查找的元素
+     * @return      {bool} 存在返回 true，不存在返回 false
+     */
+    [[nodiscard]] bool contains(const ElementType &element) const;
+
+    /**
+     * @description: 往集合末尾追加元素，可被多个线程同时调用
+     * @param       {const ElementType &} element 需要追加的元素
+     * @return      {size_type} 元素的索引
+     */
+    size_type add(const ElementType &element);
+    size_type add(ElementType &&element);
+
+    /**
+     * @description: 在集合末尾原地构造元素，可被多个线程同时调用
+     * @param       {Args &&...} args 元素构造参数
+     * @return      {size_type} 元素的索引
+     */
+    template <typename... Args>
+    size_type emplaceBack(Args &&...args);
+
+    /**
+     * @description: 获取集合指定位置处的元素，无等待；返回的引用在集合析构前一直有效
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {const ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] const ElementType &get(size_type index) const;
+
+    /**
+     * @description: 不做索引检查地获取已发布的元素，调用方保证 index < size()
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {const ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] const ElementType &getUnchecked(size_type index) const noexcept;
+
+    /**
+     * @description: 在已发布的元素中获取指定元素的位置索引
+     * @param       {const ElementType &} element 指定元素
+     * @return      {size_type} 指定元素所在的位置索引，未找到则返回 npos
+     */
+    [[nodiscard]] size_type indexOf(const ElementType &element) const;
+
+    /**
+     * @description: 按顺序访问调用时已发布的所有元素
+     * @param       {Function} function 对每个元素调用的方法
+     * @return      {void}
+     */
+    template <typename Function>
+    void forEach(Function function) const;
+
+    /**
+     * @description: 将集合转换为字符串表示，可用于打印等
+     * @param       {function<std::string(const ElementType &)>} toString 将集合中元素转换为字符串的方法
+     * @return      {string} 集合的字符串表示
+     */
+    [[nodiscard]] std::string toString(std::function<std::string(const ElementType &)> toString) const;
+
+    /**
+     * @description: 将调用时已发布的元素格式化为 "[e1, e2, ...]" 写入输出迭代器
+     * @param       {OutputIt} out 字符输出迭代器
+     * @param       {Formatter} formatter 元素格式化方法，调用方式为 out = formatter(out, element)
+     * @return      {OutputIt} 写入后的输出迭代器
+     */
+    template <typename OutputIt, typename Formatter = DefaultFormatter>
+    OutputIt formatTo(OutputIt out, Formatter formatter = Formatter{}) const;
+
+    /**
+     * @description: 将调用时已发布的元素格式化后直接写入输出流
+     * @param       {ostream &} os 输出流
+     * @param       {Formatter} formatter 元素格式化方法
+     * @return      {ostream &} 输出流
+     */
+    template <typename Formatter = DefaultFormatter>
+    std::ostream &writeTo(std::ostream &os, Formatter formatter = Formatter{}) const;
+
+    /**
+     * @description: 预先分配能容纳 capacity 个元素的所有分段，之后的追加不再申请内存
+     * @param       {size_type} capacity 需要的容量
+     * @return      {void}
+     */
+    void reserve(size_type capacity);
+
+    /**
+     * @description: 析构所有元素并释放所有分段，不能与其他任何操作并发调用
+     * @return      {void}
+     */
+    void clear();
+
+private:
+    // 第 k 个分段容量为 __FIRST_SEGMENT_CAPACITY << k
+    inline static constexpr size_type __FIRST_SEGMENT_BITS{4};
+    inline static constexpr size_type __FIRST_SEGMENT_CAPACITY{size_type{1} << __FIRST_SEGMENT_BITS};
+    inline static constexpr size_type __SEGMENT_COUNT{std::numeric_limits<size_type>::digits - __FIRST_SEGMENT_BITS};
+
+    struct __Slot {
+        alignas(ElementType) unsigned char storage[sizeof(ElementType)];
+        // 元素构造完成后置为 true，用于按顺序推进已发布的 size
+        std::atomic<bool> ready;
+
+        ElementType *element() noexcept {
+            return std::launder(reinterpret_cast<ElementType *>(storage));
+        }
+
+        const ElementType *element() const noexcept {
+            return std::launder(reinterpret_cast<const ElementType *>(storage));
+        }
+    };
+    using __SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<__Slot>;
+    using __SlotAllocatorTraits = std::allocator_traits<__SlotAllocator>;
+    using __ListOperation = ListIndexChecker::Operation;
+
+    struct __Position {
+        size_type segment;
+        size_type offset;
+    };
+
+    __SlotAllocator __allocator;
+    std::atomic<__Slot *> __segments[__SEGMENT_COUNT];
+    // 已领取的槽位数量
+    std::atomic<size_type> __reserved;
+    // 已发布的元素数量，[0, __published) 中的元素都已构造完成
+    std::atomic<size_type> __published;
+
+    static __Position __locate(size_type index) noexcept;
+    static size_type __segmentCapacity(size_type segment) noexcept;
+    /**
+     * @description: 获取指定分段，不存在时分配并尝试安装，安装失败说明其他线程已经安装，释放自己分配的分段
+     * @return      {__Slot *} 分段首地址
+     */
+    __Slot *__acquireSegment(size_type segment);
+    /**
+     * @description: 从当前已发布的位置开始，把连续就绪的槽位发布出去，任何线程都可以帮忙推进
+     * @return      {void}
+     */
+    void __publish() noexcept;
+    void __releaseSegments();
+};
+
+template <typename ElementType, typename Allocator>
+ConcurrentArrayList<ElementType, Allocator>::ConcurrentArrayList(const Allocator &allocator) noexcept :
+    __allocator{allocator}, __reserved{0}, __published{0} {
+    for (auto &segment : __segments) {
+        segment.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template <typename ElementType, typename Allocator>
+ConcurrentArrayList<ElementType, Allocator>::~ConcurrentArrayList() {
+    __releaseSegments();
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] typename ConcurrentArrayList<ElementType, Allocator>::size_type ConcurrentArrayList<ElementType, Allocator>::size() const noexcept {
+    return __published.load(std::memory_order_acquire);
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] bool ConcurrentArrayList<ElementType, Allocator>::isEmpty() const noexcept {
+    return size() == 0;
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] bool ConcurrentArrayList<ElementType, Allocator>::contains(const ElementType &element) const {
+    return indexOf(element) != npos;
+}
+
+template <typename ElementType, typename Allocator>
+typename ConcurrentArrayList<ElementType, Allocator>::size_type ConcurrentArrayList<ElementType, Allocator>::add(const ElementType &element) {
+    return emplaceBack(element);
+}
+
+template <typename ElementType, typename Allocator>
+typename ConcurrentArrayList<ElementType, Allocator>::size_type ConcurrentArrayList<ElementType, Allocator>::add(ElementType &&element) {
+    return emplaceBack(std::move(element));
+}
+
+template <typename ElementType, typename Allocator>
+template <typename... Args>
+typename ConcurrentArrayList<ElementType, Allocator>::size_type ConcurrentArrayList<ElementType, Allocator>::emplaceBack(Args &&...args) {
+    if constexpr (!std::is_nothrow_constructible_v<ElementType, Args &&...>) {
+        // 领取的槽位无法归还，构造可能抛出异常时先在槽位外构造好，再移动进去
+        static_assert(std::is_nothrow_move_constructible_v<ElementType>, "ElementType must be nothrow move constructible");
+        ElementType value(std::forward<Args>(args)...);
+        return emplaceBack(std::move(value));
+    } else {
+        // 先安装槽位所在的分段再领取槽位：分段分配失败时还没有领取任何槽位，
+        // 领取之后不再有可能失败的操作，领取的槽位一定会被构造并标记就绪
+        size_type index{__reserved.load(std::memory_order_relaxed)};
+        __Slot *slots{nullptr};
+        do {
+            slots = __acquireSegment(__locate(index).segment);
+        } while (!__reserved.compare_exchange_weak(index, index + 1, std::memory_order_relaxed, std::memory_order_relaxed));
+        __Slot &slot{slots[__locate(index).offset]};
+        ::new (static_cast<void *>(slot.storage)) ElementType(std::forward<Args>(args)...);
+        // 与 __publish 中的读取构成 store -> load 的 Dekker 模式，必须是 seq_cst，见 __publish
+        slot.ready.store(true, std::memory_order_seq_cst);
+        __publish();
+        return index;
+    }
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] const ElementType &ConcurrentArrayList<ElementType, Allocator>::get(size_type index) const {
+    ListIndexChecker::checkIndex<__ListOperation::GET>(index, size());
+    return getUnchecked(index);
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] const ElementType &ConcurrentArrayList<ElementType, Allocator>::getUnchecked(size_type index) const noexcept {
+    __Position position{__locate(index)};
+    return *__segments[position.segment].load(std::memory_order_relaxed)[position.offset].element();
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] typename ConcurrentArrayList<ElementType, Allocator>::size_type ConcurrentArrayList<ElementType, Allocator>::indexOf(const ElementType &element) const {
+    size_type index{0};
+    size_type published{size()};
+    for (size_type segment{0}; index < published; ++segment) {
+        const __Slot *slots{__segments[segment].load(std::memory_order_relaxed)};
+        size_type count{std::min(__segmentCapacity(segment), published - index)};
+        for (size_type offset{0}; offset < count; ++offset, ++index) {
+            if (*slots[offset].element() == element) {
+                return index;
+            }
+        }
+    }
+    return npos;
+}
+
+template <typename ElementType, typename Allocator>
+template <typename Function>
+void ConcurrentArrayList<ElementType, Allocator>::forEach(Function function) const {
+    size_type index{0};
+    size_type published{size()};
+    for (size_type segment{0}; index < published; ++segment) {
+        const __Slot *slots{__segments[segment].load(std::memory_order_relaxed)};
+        size_type count{std::min(__segmentCapacity(segment), published - index)};
+        for (size_type offset{0}; offset < count; ++offset, ++index) {
+            function(*slots[offset].element());
+        }
+    }
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] std::string ConcurrentArrayList<ElementType, Allocator>::toString(std::function<std::string(const ElementType &)> toString) const {
+    std::string result{};
+    formatTo(std::back_inserter(result), ToStringFormatter{std::move(toString)});
+    return result;
+}
+
+template <typename ElementType, typename Allocator>
+template <typename OutputIt, typename Formatter>
+OutputIt ConcurrentArrayList<ElementType, Allocator>::formatTo(OutputIt out, Formatter formatter) const {
+    return formatIndexed(*this, size(), out, std::move(formatter));
+}
+
+template <typename ElementType, typename Allocator>
+template <typename Formatter>
+std::ostream &ConcurrentArrayList<ElementType, Allocator>::writeTo(std::ostream &os, Formatter formatter) const {
+    formatTo(std::ostreambuf_iterator<char>{os}, std::move(formatter));
+    return os;
+}
+
+template <typename ElementType, typename Allocator>
+void ConcurrentArrayList<ElementType, Allocator>::reserve(size_type capacity) {
+    if (capacity == 0) {
+        return;
+    }
+    size_type last{__locate(capacity - 1).segment};
+    for (size_type segment{0}; segment <= last; ++segment) {
+        __acquireSegment(segment);
+    }
+}
+
+template <typename ElementType, typename Allocator>
+void ConcurrentArrayList<ElementType, Allocator>::clear() {
+    __releaseSegments();
+    __reserved.store(0, std::memory_order_relaxed);
+    __published.store(0, std::memory_order_relaxed);
+}
+
+template <typename ElementType, typename Allocator>
+typename ConcurrentArrayList<ElementType, Allocator>::__Position ConcurrentArrayList<ElementType, Allocator>::__locate(size_type index) noexcept {
+    // 第 k 个分段覆盖 [F * (2^k - 1), F * (2^(k+1) - 1))，index + F 的最高位即可确定分段
+    size_type biased{index + __FIRST_SEGMENT_CAPACITY};
+    auto highestBit{static_cast<size_type>(std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(biased))};
+    size_type segment{highestBit - __FIRST_SEGMENT_BITS};
+    return __Position{segment, biased - (size_type{1} << highestBit)};
+}
+
+template <typename ElementType, typename Allocator>
+typename ConcurrentArrayList<ElementType, Allocator>::size_type ConcurrentArrayList<ElementType, Allocator>::__segmentCapacity(size_type segment) noexcept {
+    return __FIRST_SEGMENT_CAPACITY << segment;
+}
+
+template <typename ElementType, typename Allocator>
+typename ConcurrentArrayList<ElementType, Allocator>::__Slot *ConcurrentArrayList<ElementType, Allocator>::__acquireSegment(size_type segment) {
+    // 分段的安装和读取同样参与 __publish 的全序：__publish 读到空分段时，该分段上的写者一定能看到之前的推进
+    __Slot *slots{__segments[segment].load(std::memory_order_seq_cst)};
+    if (slots != nullptr) {
+        return slots;
+    }
+    size_type capacity{__segmentCapacity(segment)};
+    __Slot *newSlots{__SlotAllocatorTraits::allocate(__allocator, capacity)};
+    for (size_type i{0}; i < capacity; ++i) {
+        ::new (static_cast<void *>(&newSlots[i].ready)) std::atomic<bool>{false};
+    }
+    if (__segments[segment].compare_exchange_strong(slots, newSlots, std::memory_order_seq_cst, std::memory_order_seq_cst)) {
+        return newSlots;
+    }
+    __SlotAllocatorTraits::deallocate(__allocator, newSlots, capacity);
+    return slots;
+}
+
+template <typename ElementType, typename Allocator>
+void ConcurrentArrayList<ElementType, Allocator>::__publish() noexcept {
+    // 写者 B 先写自己槽位的 ready 再读 __published，写者 A 先 CAS 推进 __published 再读 B 槽位的 ready。
+    // acquire/release 允许两者都读到旧值，双方都返回后 B 的元素将一直不被发布；
+    // 这几次读写都使用 seq_cst 后处于同一个全序中，至少有一方能看到对方的写入并继续推进
+    size_type published{__published.load(std::memory_order_seq_cst)};
+    while (published < __reserved.load(std::memory_order_acquire)) {
+        __Position position{__locate(published)};
+        __Slot *slots{__segments[position.segment].load(std::memory_order_seq_cst)};
+        if (slots == nullptr || !slots[position.offset].ready.load(std::memory_order_seq_cst)) {
+            // 前面的槽位还没构造完，由它的写者负责继续推进
+            return;
+        }
+        // 失败时 published 会被更新为最新值，继续从那里推进
+        if (__published.compare_exchange_weak(published, published + 1, std::memory_order_seq_cst, std::memory_order_seq_cst)) {
+            ++published;
+        }
+    }
+}
+
+template <typename ElementType, typename Allocator>
+void ConcurrentArrayList<ElementType, Allocator>::__releaseSegments() {
+    for (size_type segment{0}; segment < __SEGMENT_COUNT; ++segment) {
+        __Slot *slots{__segments[segment].exchange(nullptr, std::memory_order_acq_rel)};
+        if (slots == nullptr) {
+            continue;
+        }
+        size_type capacity{__segmentCapacity(segment)};
+        for (size_type offset{0}; offset < capacity; ++offset) {
+            // 只有标记就绪的槽位上构造过元素
+            if (slots[offset].ready.load(std::memory_order_acquire)) {
+                std::destroy_at(slots[offset].element());
+            }
+            std::destroy_at(&slots[offset].ready);
+        }
+        __SlotAllocatorTraits::deallocate(__allocator, slots, capacity);
+    }
+}
+
+} // namespace dsa
+
+#endif
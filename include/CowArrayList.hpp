@@ -0,0 +1,547 @@
+#ifndef __COW_ARRAY_LIST_H__
+#define __COW_ARRAY_LIST_H__
+
+#include "ListIndexChecker.hpp"
+#include "StaticList.hpp"
+#include "format.hpp"
+#include "simd_search.hpp"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 15:08:44
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 15:08:44
+ * @FilePath     : /include/CowArrayList.hpp
+ * @Description  : 写时复制的分块 List。元素按顺序存放在容量为 2^ChunkShift 的块中，除最后一块外都是满的，get(index) 仍为 O(1)。
+ *                 块表和块都通过 shared_ptr 共享，snapshot() 和拷贝构造只复制块表的指针，为 O(1)；
+ *                 修改时只有被共享的块表和被修改的块才会被复制，末尾追加、set 只复制一个块。
+ *                 快照是不可变的，可以交给其它线程无锁读取；集合本身同一时间只能由一个线程修改
+ */
+template <typename ElementType, std::size_t ChunkShift = 10>
+class CowArrayList final : public StaticList<CowArrayList<ElementType, ChunkShift>> {
+    static_assert(ChunkShift > 0 && ChunkShift < 32, "ChunkShift must be in [1, 32)");
+
+    using __Chunk = std::vector<ElementType>;
+    using __Table = std::vector<std::shared_ptr<__Chunk>>;
+
+public:
+    using size_type = typename StaticList<CowArrayList>::size_type;
+    using value_type = ElementType;
+    inline static constexpr size_type CHUNK_SIZE{size_type{1} << ChunkShift};
+
+    /*
+     * 某一时刻集合内容的只读视图，持有块表的引用，集合之后的修改对其不可见
+     */
+    class Snapshot {
+    public:
+        Snapshot() noexcept;
+
+        [[nodiscard]] size_type size() const noexcept;
+        [[nodiscard]] bool isEmpty() const noexcept;
+        [[nodiscard]] const ElementType &get(size_type index) const;
+        [[nodiscard]] const ElementType &getUnchecked(size_type index) const noexcept;
+        [[nodiscard]] size_type indexOf(const ElementType &element) const;
+        [[nodiscard]] bool contains(const ElementType &element) const;
+        template <typename Function>
+        void forEach(Function function) const;
+        [[nodiscard]] std::string toString(std::function<std::string(const ElementType &)> toString) const;
+        template <typename OutputIt, typename Formatter = DefaultFormatter>
+        OutputIt formatTo(OutputIt out, Formatter formatter = Formatter{}) const;
+        template <typename Formatter = DefaultFormatter>
+        std::ostream &writeTo(std::ostream &os, Formatter formatter = Formatter{}) const;
+
+    private:
+        friend class CowArrayList;
+
+        std::shared_ptr<const __Table> __table;
+        size_type __size;
+
+        Snapshot(std::shared_ptr<const __Table> table, size_type size) noexcept;
+    };
+
+    CowArrayList() noexcept;
+    /**
+     * @description: 拷贝构造与 snapshot() 一样只共享块表，O(1)
+     */
+    CowArrayList(const CowArrayList &rhs) = default;
+    CowArrayList(CowArrayList &&rhs) noexcept;
+    CowArrayList &operator=(const CowArrayList &rhs) = default;
+    CowArrayList &operator=(CowArrayList &&rhs) noexcept;
+    ~CowArrayList() = default;
+
+    /**
+     * @description: 清除集合中的所有元素，已取得的快照不受影响
+     * @return      {void}
+     */
+    void clear() noexcept;
+
+    /**
+     * @description: 获取集合中元素数量
+     * @return      {size_type} 集合中元素的数量
+     */
+    [[nodiscard]] size_type size() const noexcept;
+
+    /**
+     * @description: 检查集合是否有元素
+     * @return      {bool} 无元素返回 true，有元素返回 false
+     */
+    [[nodiscard]] bool isEmpty() const noexcept;
+
+    /**
+     * @description: 往集合末尾插入元素，最多复制块表和最后一个块
+     * @param       {const ElementType &} element 需要插入的元素
+     * @return      {void}
+     */
+    void add(const ElementType &element);
+    void add(ElementType &&element);
+
+    /**
+     * @description: 在集合指定位置处插入元素，其后每个块都要移动一个元素，被共享的块会被复制
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {const ElementType &} element 要插入的元素
+     * @return      {void}
+     */
+    void add(size_type index, const ElementType &element);
+    void add(size_type index, ElementType &&element);
+
+    /**
+     * @description: 获取集合指定位置处的元素，O(1)。元素只能以常量引用访问，修改必须经过 set
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {const ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] const ElementType &get(size_type index) const;
+
+    /**
+     * @description: 不做索引检查地访问集合指定位置处的元素，调用方保证 index < size()
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {const ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] const ElementType &getUnchecked(size_type index) const noexcept;
+
+    /**
+     * @description: 将集合指定位置处的元素设置为指定元素，最多复制块表和一个块
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @param       {const ElementType &} element 要设置的元素
+     * @return      {ElementType} 设置之前的元素
+     */
+    ElementType set(size_type index, const ElementType &element);
+    ElementType set(size_type index, ElementType &&element);
+
+    /**
+     * @description: 删除集合指定位置处的元素，其后每个块都要移动一个元素，被共享的块会被复制
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType} 被删除的元素
+     */
+    ElementType remove(size_type index);
+
+    /**
+     * @description: 在集合中获取指定元素的位置索引
+     * @param       {const ElementType &} element 指定元素
+     * @return      {size_type} 指定元素所在的位置索引，未找到则返回 npos
+     */
+    [[nodiscard]] size_type indexOf(const ElementType &element) const;
+
+    /**
+     * @description: 按顺序访问集合中的所有元素
+     * @param       {Function} function 对每个元素调用的方法
+     * @return      {void}
+     */
+    template <typename Function>
+    void forEach(Function function) const;
+
+    /**
+     * @description: 将集合转换为字符串表示，可用于打印等
+     * @param       {function<std::string(const ElementType &)>} toString 将集合中元素转换为字符串的方法
+     * @return      {string} 集合的字符串表示
+     */
+    [[nodiscard]] std::string toString(std::function<std::string(const ElementType &)> toString) const;
+
+    /**
+     * @description: 获取集合当前内容的不可变快照，O(1)
+     * @return      {Snapshot} 快照
+     */
+    [[nodiscard]] Snapshot snapshot() const noexcept;
+
+    /**
+     * @description: 检查块表是否与快照或其它集合共享，主要用于测试
+     * @return      {bool} 共享返回 true
+     */
+    [[nodiscard]] bool isShared() const noexcept;
+
+private:
+    using __Base = StaticList<CowArrayList>;
+    using __ListOperation = typename __Base::_Operation;
+
+    inline static constexpr size_type __CHUNK_MASK{CHUNK_SIZE - 1};
+
+    std::shared_ptr<__Table> __table;
+    size_type __size;
+
+    /**
+     * @description: 判断 shared_ptr 是否独占对象。其它线程可能刚释放最后一个共享引用，
+     *               读到 use_count() == 1 后需要 acquire 栅栏，保证它们之前的读取发生在本线程随后的修改之前
+     * @return      {bool} 独占返回 true
+     */
+    template <typename T>
+    static bool __isUnique(const std::shared_ptr<T> &pointer) noexcept;
+    static const ElementType &__at(const __Table &table, size_type index) noexcept;
+    static size_type __indexOf(const __Table *table, size_type size, const ElementType &element);
+    template <typename Function>
+    static void __forEach(const __Table *table, size_type size, Function &function);
+
+    /**
+     * @description: 获取可修改的块表，块表被共享时复制一份（只复制块指针）
+     * @return      {__Table &} 独占的块表
+     */
+    __Table &__mutableTable();
+    /**
+     * @description: 获取可修改的块，块被共享时复制一份
+     * @param       {size_type} chunkIndex 块序号
+     * @return      {__Chunk &} 独占的块
+     */
+    __Chunk &__mutableChunk(size_type chunkIndex);
+    template <typename T>
+    void __addBack(T &&element);
+    void __insert(size_type index, ElementType &&element);
+    template <typename T>
+    ElementType __set(size_type index, T &&element);
+};
+
+template <typename ElementType, std::size_t ChunkShift>
+CowArrayList<ElementType, ChunkShift>::Snapshot::Snapshot() noexcept :
+    __table{}, __size{0} {
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+CowArrayList<ElementType, ChunkShift>::Snapshot::Snapshot(std::shared_ptr<const __Table> table, size_type size) noexcept :
+    __table{std::move(table)}, __size{size} {
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] typename CowArrayList<ElementType, ChunkShift>::size_type CowArrayList<ElementType, ChunkShift>::Snapshot::size() const noexcept {
+    return __size;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] bool CowArrayList<ElementType, ChunkShift>::Snapshot::isEmpty() const noexcept {
+    return __size == 0;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] const ElementType &CowArrayList<ElementType, ChunkShift>::Snapshot::get(size_type index) const {
+    ListIndexChecker::checkIndex<ListIndexChecker::Operation::GET>(index, __size);
+    return __at(*__table, index);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] const ElementType &CowArrayList<ElementType, ChunkShift>::Snapshot::getUnchecked(size_type index) const noexcept {
+    return __at(*__table, index);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] typename CowArrayList<ElementType, ChunkShift>::size_type CowArrayList<ElementType, ChunkShift>::Snapshot::indexOf(const ElementType &element) const {
+    return __indexOf(__table.get(), __size, element);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] bool CowArrayList<ElementType, ChunkShift>::Snapshot::contains(const ElementType &element) const {
+    return indexOf(element) != __Base::npos;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+template <typename Function>
+void CowArrayList<ElementType, ChunkShift>::Snapshot::forEach(Function function) const {
+    __forEach(__table.get(), __size, function);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] std::string CowArrayList<ElementType, ChunkShift>::Snapshot::toString(std::function<std::string(const ElementType &)> toString) const {
+    std::string result{};
+    formatTo(std::back_inserter(result), ToStringFormatter{std::move(toString)});
+    return result;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+template <typename OutputIt, typename Formatter>
+OutputIt CowArrayList<ElementType, ChunkShift>::Snapshot::formatTo(OutputIt out, Formatter formatter) const {
+    return formatIndexed(*this, __size, out, std::move(formatter));
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+template <typename Formatter>
+std::ostream &CowArrayList<ElementType, ChunkShift>::Snapshot::writeTo(std::ostream &os, Formatter formatter) const {
+    formatTo(std::ostreambuf_iterator<char>{os}, std::move(formatter));
+    return os;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+CowArrayList<ElementType, ChunkShift>::CowArrayList() noexcept :
+    __table{}, __size{0} {
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+CowArrayList<ElementType, ChunkShift>::CowArrayList(CowArrayList &&rhs) noexcept :
+    __table{std::move(rhs.__table)}, __size{std::exchange(rhs.__size, 0)} {
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+CowArrayList<ElementType, ChunkShift> &CowArrayList<ElementType, ChunkShift>::operator=(CowArrayList &&rhs) noexcept {
+    if (this != &rhs) {
+        __table = std::move(rhs.__table);
+        __size = std::exchange(rhs.__size, 0);
+    }
+    return *this;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+void CowArrayList<ElementType, ChunkShift>::clear() noexcept {
+    __table.reset();
+    __size = 0;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] typename CowArrayList<ElementType, ChunkShift>::size_type CowArrayList<ElementType, ChunkShift>::size() const noexcept {
+    return __size;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] bool CowArrayList<ElementType, ChunkShift>::isEmpty() const noexcept {
+    return __size == 0;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+void CowArrayList<ElementType, ChunkShift>::add(const ElementType &element) {
+    __addBack(element);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+void CowArrayList<ElementType, ChunkShift>::add(ElementType &&element) {
+    __addBack(std::move(element));
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+void CowArrayList<ElementType, ChunkShift>::add(size_type index, const ElementType &element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, __size);
+    // element 可能引用集合中的元素，移动元素之前先复制一份
+    __insert(index, ElementType(element));
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+void CowArrayList<ElementType, ChunkShift>::add(size_type index, ElementType &&element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, __size);
+    __insert(index, std::move(element));
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] const ElementType &CowArrayList<ElementType, ChunkShift>::get(size_type index) const {
+    __Base::template _checkIndex<__ListOperation::GET>(index, __size);
+    return __at(*__table, index);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] const ElementType &CowArrayList<ElementType, ChunkShift>::getUnchecked(size_type index) const noexcept {
+    return __at(*__table, index);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+ElementType CowArrayList<ElementType, ChunkShift>::set(size_type index, const ElementType &element) {
+    return __set(index, element);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+ElementType CowArrayList<ElementType, ChunkShift>::set(size_type index, ElementType &&element) {
+    return __set(index, std::move(element));
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+ElementType CowArrayList<ElementType, ChunkShift>::remove(size_type index) {
+    __Base::template _checkIndex<__ListOperation::REMOVE>(index, __size);
+    size_type chunkIndex{index >> ChunkShift};
+    __Chunk *chunk{&__mutableChunk(chunkIndex)};
+    ElementType old{std::move((*chunk)[index & __CHUNK_MASK])};
+    chunk->erase(chunk->begin() + (index & __CHUNK_MASK));
+    // 后面每个块的第一个元素前移到前一个块的末尾，保持除最后一块外都是满的
+    __Table &table{*__table};
+    for (size_type i = chunkIndex + 1; i < table.size(); ++i) {
+        __Chunk &next{__mutableChunk(i)};
+        chunk->push_back(std::move(next.front()));
+        next.erase(next.begin());
+        chunk = &next;
+    }
+    if (table.back()->empty()) {
+        table.pop_back();
+    }
+    --__size;
+    return old;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] typename CowArrayList<ElementType, ChunkShift>::size_type CowArrayList<ElementType, ChunkShift>::indexOf(const ElementType &element) const {
+    return __indexOf(__table.get(), __size, element);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+template <typename Function>
+void CowArrayList<ElementType, ChunkShift>::forEach(Function function) const {
+    __forEach(__table.get(), __size, function);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] std::string CowArrayList<ElementType, ChunkShift>::toString(std::function<std::string(const ElementType &)> toString) const {
+    std::string result{};
+    __Base::formatTo(std::back_inserter(result), ToStringFormatter{std::move(toString)});
+    return result;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] typename CowArrayList<ElementType, ChunkShift>::Snapshot CowArrayList<ElementType, ChunkShift>::snapshot() const noexcept {
+    return Snapshot{__table, __size};
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+[[nodiscard]] bool CowArrayList<ElementType, ChunkShift>::isShared() const noexcept {
+    return __table && !__isUnique(__table);
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+template <typename T>
+bool CowArrayList<ElementType, ChunkShift>::__isUnique(const std::shared_ptr<T> &pointer) noexcept {
+    if (pointer.use_count() != 1) {
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+const ElementType &CowArrayList<ElementType, ChunkShift>::__at(const __Table &table, size_type index) noexcept {
+    return (*table[index >> ChunkShift])[index & __CHUNK_MASK];
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+typename CowArrayList<ElementType, ChunkShift>::size_type CowArrayList<ElementType, ChunkShift>::__indexOf(const __Table *table, size_type size, const ElementType &element) {
+    if (size == 0) {
+        return __Base::npos;
+    }
+    for (size_type i = 0; i < table->size(); ++i) {
+        const __Chunk &chunk{*(*table)[i]};
+        size_type offset{};
+        if constexpr (simd::is_searchable_v<ElementType>) {
+            offset = simd::findFirst(chunk.data(), chunk.size(), element);
+        } else {
+            offset = std::find(chunk.begin(), chunk.end(), element) - chunk.begin();
+        }
+        if (offset != chunk.size()) {
+            return (i << ChunkShift) + offset;
+        }
+    }
+    return __Base::npos;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+template <typename Function>
+void CowArrayList<ElementType, ChunkShift>::__forEach(const __Table *table, size_type size, Function &function) {
+    if (size == 0) {
+        return;
+    }
+    for (const auto &chunk : *table) {
+        for (const auto &element : *chunk) {
+            function(element);
+        }
+    }
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+typename CowArrayList<ElementType, ChunkShift>::__Table &CowArrayList<ElementType, ChunkShift>::__mutableTable() {
+    if (!__table) {
+        __table = std::make_shared<__Table>();
+    } else if (!__isUnique(__table)) {
+        __table = std::make_shared<__Table>(*__table);
+    }
+    return *__table;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+typename CowArrayList<ElementType, ChunkShift>::__Chunk &CowArrayList<ElementType, ChunkShift>::__mutableChunk(size_type chunkIndex) {
+    std::shared_ptr<__Chunk> &chunk{__mutableTable()[chunkIndex]};
+    if (!__isUnique(chunk)) {
+        auto copy{std::make_shared<__Chunk>()};
+        copy->reserve(CHUNK_SIZE);
+        copy->assign(chunk->begin(), chunk->end());
+        chunk = std::move(copy);
+    }
+    return *chunk;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+template <typename T>
+void CowArrayList<ElementType, ChunkShift>::__addBack(T &&element) {
+    __Table &table{__mutableTable()};
+    if ((__size & __CHUNK_MASK) == 0) {
+        // element 可能引用某个块中的元素，新块只追加到块表末尾，不影响已有块
+        auto chunk{std::make_shared<__Chunk>()};
+        chunk->reserve(CHUNK_SIZE);
+        chunk->push_back(std::forward<T>(element));
+        table.push_back(std::move(chunk));
+    } else {
+        __Chunk &last{__mutableChunk(table.size() - 1)};
+        // 块已预留 CHUNK_SIZE 的容量，push_back 不会重新分配，引用自身元素也是安全的
+        last.push_back(std::forward<T>(element));
+    }
+    ++__size;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+void CowArrayList<ElementType, ChunkShift>::__insert(size_type index, ElementType &&element) {
+    if (index == __size) {
+        __addBack(std::move(element));
+        return;
+    }
+    __Table &table{__mutableTable()};
+    if ((__size & __CHUNK_MASK) == 0) {
+        auto chunk{std::make_shared<__Chunk>()};
+        chunk->reserve(CHUNK_SIZE);
+        table.push_back(std::move(chunk));
+    }
+    // 插入到目标块后，溢出的最后一个元素依次挤入后一个块的开头
+    ElementType carry{std::move(element)};
+    size_type offset{index & __CHUNK_MASK};
+    for (size_type i = index >> ChunkShift; i < table.size(); ++i, offset = 0) {
+        __Chunk &chunk{__mutableChunk(i)};
+        if (chunk.size() < CHUNK_SIZE) {
+            chunk.insert(chunk.begin() + offset, std::move(carry));
+            break;
+        }
+        // 满块先移出最后一个元素再插入，块的容量始终不超过 CHUNK_SIZE
+        ElementType overflow{std::move(chunk.back())};
+        chunk.pop_back();
+        chunk.insert(chunk.begin() + offset, std::move(carry));
+        carry = std::move(overflow);
+    }
+    ++__size;
+}
+
+template <typename ElementType, std::size_t ChunkShift>
+template <typename T>
+ElementType CowArrayList<ElementType, ChunkShift>::__set(size_type index, T &&element) {
+    __Base::template _checkIndex<__ListOperation::SET>(index, __size);
+    ElementType value(std::forward<T>(element));
+    ElementType &slot{__mutableChunk(index >> ChunkShift)[index & __CHUNK_MASK]};
+    std::swap(slot, value);
+    return value;
+}
+
+} // namespace dsa
+
+#endif
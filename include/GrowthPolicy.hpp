@@ -0,0 +1,70 @@
+#ifndef __GROWTH_POLICY_H__
+#define __GROWTH_POLICY_H__
+
+#include <algorithm>
+#include <cstddef>
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 14:02:37
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 14:02:37
+ * @FilePath     : /include/GrowthPolicy.hpp
+ * @Description  : 数组类容器的扩容、缩容策略。
+ *                 扩容系数为 GrowthNumerator / GrowthDenominator；元素数量低于 capacity / ShrinkDivisor 时缩容，
+ *                 缩容后的使用率为 2 / ShrinkDivisor，而不是缩到刚好装满，避免在阈值附近交替增删时反复分配内存
+ */
+template <std::size_t GrowthNumerator = 2, std::size_t GrowthDenominator = 1, std::size_t ShrinkDivisor = 4, std::size_t MinCapacity = 10, bool ShrinkEnabled = true>
+struct ArrayGrowthPolicy {
+    static_assert(GrowthNumerator > GrowthDenominator && GrowthDenominator > 0, "growth factor must be greater than 1");
+    static_assert(ShrinkDivisor > 2, "shrink divisor must be greater than 2 to keep hysteresis");
+    static_assert(MinCapacity > 0, "minimum capacity must be positive");
+
+    using size_type = std::size_t;
+    inline static constexpr size_type MIN_CAPACITY{MinCapacity};
+    inline static constexpr bool SHRINK_ENABLED{ShrinkEnabled};
+
+    /**
+     * @description: 计算扩容后的容量
+     * @param       {size_type} capacity 当前容量
+     * @param       {size_type} needCapacity 至少需要的容量
+     * @return      {size_type} 扩容后的容量
+     */
+    static constexpr size_type grow(size_type capacity, size_type needCapacity) noexcept {
+        return std::max({needCapacity, capacity / GrowthDenominator * GrowthNumerator, capacity + 1, MIN_CAPACITY});
+    }
+
+    /**
+     * @description: 判断是否需要缩容
+     * @param       {size_type} size 当前元素数量
+     * @param       {size_type} capacity 当前容量
+     * @return      {bool} 需要缩容返回 true，否则返回 false
+     */
+    static constexpr bool shouldShrink(size_type size, size_type capacity) noexcept {
+        return SHRINK_ENABLED && capacity > MIN_CAPACITY && size < capacity / ShrinkDivisor;
+    }
+
+    /**
+     * @description: 计算缩容后的容量
+     * @param       {size_type} size 当前元素数量
+     * @return      {size_type} 缩容后的容量
+     */
+    static constexpr size_type shrink(size_type size) noexcept {
+        return std::max(size * ShrinkDivisor / 2, MIN_CAPACITY);
+    }
+};
+
+// 默认策略：2 倍扩容，使用率低于 1/4 时缩容到 1/2
+using DefaultGrowthPolicy = ArrayGrowthPolicy<>;
+
+// 1.5 倍扩容，释放的旧内存块有机会被后续扩容复用
+using HalfGrowthPolicy = ArrayGrowthPolicy<3, 2>;
+
+// 只扩容不缩容，适合元素数量在一定范围内反复波动的队列
+using NoShrinkGrowthPolicy = ArrayGrowthPolicy<2, 1, 4, 10, false>;
+
+} // namespace dsa
+
+#endif
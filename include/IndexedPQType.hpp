@@ -0,0 +1,448 @@
+#ifndef __INDEXED_PQ_TYPE_H__
+#define __INDEXED_PQ_TYPE_H__
+
+#include "QueueException.hpp"
+#include "heap_operation.hpp"
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dsa {
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 21:48:05
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 21:48:05
+ * @FilePath     : /include/IndexedPQType.hpp
+ * @Description  : 可寻址的优先队列。入队时返回一个稳定的句柄，之后可以通过句柄在 O(log n) 内修改优先级、删除元素，
+ *                 适合 Dijkstra、定时器等入队后优先级还会改变的场景，不必重复入队再惰性跳过过期元素。
+ *                 每个句柄对应一个槽位，槽位记录元素在堆中的位置，调整堆时通过位置观察者同步更新；
+ *                 槽位被释放后会递增代数，过期的句柄不会误指向复用该槽位的新元素。
+ *                 Arity 与 Compare 的含义与 PQType 相同
+ */
+template <typename ElementType, std::size_t Arity = 2, typename Compare = std::less<ElementType>>
+class IndexedPQType {
+public:
+    using size_type = std::size_t;
+    using value_type = ElementType;
+    using value_compare = Compare;
+
+    /**
+     * @description: 元素的句柄，默认构造的句柄不指向任何元素
+     */
+    class Handle {
+    public:
+        Handle() = default;
+
+        bool operator==(const Handle &other) const noexcept {
+            return __slot == other.__slot && __generation == other.__generation;
+        }
+
+        bool operator!=(const Handle &other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        friend class IndexedPQType;
+
+        Handle(size_type slot, size_type generation) noexcept :
+            __slot{slot}, __generation{generation} {
+        }
+
+        size_type __slot{std::numeric_limits<size_type>::max()};
+        size_type __generation{0};
+    };
+
+    IndexedPQType() = default;
+    explicit IndexedPQType(const Compare &compare);
+    IndexedPQType(const IndexedPQType &) = default;
+    IndexedPQType(IndexedPQType &&other) noexcept;
+    IndexedPQType &operator=(const IndexedPQType &) = default;
+    IndexedPQType &operator=(IndexedPQType &&other) noexcept;
+
+    /**
+     * @description: 将队列置空，之前返回的句柄全部失效
+     * @return      {void}
+     */
+    void makeEmpty() noexcept;
+    /**
+     * @description: 检查队列是否为空
+     * @return      {bool} 若为空返回 true，否则返回 false
+     */
+    [[nodiscard]] bool isEmpty() const noexcept;
+    /**
+     * @description: 获取队列中元素的个数
+     * @return      {size_type} 元素个数
+     */
+    [[nodiscard]] size_type size() const noexcept;
+    /**
+     * @description: 检查句柄指向的元素是否仍在队列中
+     * @param       {Handle} handle 元素的句柄
+     * @return      {bool} 若仍在队列中返回 true，否则返回 false
+     */
+    [[nodiscard]] bool contains(Handle handle) const noexcept;
+    /**
+     * @description: 查看句柄指向的元素
+     * @param       {Handle} handle 元素的句柄
+     * @return      {const ElementType &} 句柄指向的元素
+     */
+    [[nodiscard]] const ElementType &get(Handle handle) const;
+    /**
+     * @description: 查看优先级最高的元素，不出队
+     * @return      {const ElementType &} 队列中优先级最高的元素
+     */
+    [[nodiscard]] const ElementType &top() const;
+    /**
+     * @description: 获取优先级最高的元素的句柄
+     * @return      {Handle} 队列中优先级最高的元素的句柄
+     */
+    [[nodiscard]] Handle topHandle() const;
+    /**
+     * @description: 元素入队
+     * @param       {ElementType} e 要插入的元素
+     * @return      {Handle} 新元素的句柄
+     */
+    Handle enqueue(const ElementType &e);
+    /**
+     * @description: 元素入队，移动 e 而不拷贝
+     * @param       {ElementType} e 要插入的元素
+     * @return      {Handle} 新元素的句柄
+     */
+    Handle enqueue(ElementType &&e);
+    /**
+     * @description: 用 args 直接构造元素后入队
+     * @param       {Args &&...} args 元素构造函数的参数
+     * @return      {Handle} 新元素的句柄
+     */
+    template <typename... Args>
+    Handle emplace(Args &&...args);
+    /**
+     * @description: 优先级最高的元素出队，其句柄随之失效
+     * @return      {ElementType} 队列中优先级最高的元素
+     */
+    ElementType dequeue();
+    /**
+     * @description: 将句柄指向的元素替换为 e，并根据优先级升高或降低向上或向下调整
+     * @param       {Handle} handle 元素的句柄
+     * @param       {ElementType} e 新的元素
+     * @return      {void}
+     */
+    void updatePriority(Handle handle, const ElementType &e);
+    /**
+     * @description: 将句柄指向的元素替换为 e，并根据优先级升高或降低向上或向下调整
+     * @param       {Handle} handle 元素的句柄
+     * @param       {ElementType} e 新的元素
+     * @return      {void}
+     */
+    void updatePriority(Handle handle, ElementType &&e);
+    /**
+     * @description: 删除句柄指向的元素，其句柄随之失效
+     * @param       {Handle} handle 元素的句柄
+     * @return      {ElementType} 被删除的元素
+     */
+    ElementType erase(Handle handle);
+
+private:
+    static constexpr size_type __NPOS{std::numeric_limits<size_type>::max()};
+
+    struct __Node {
+        template <typename... Args>
+        explicit __Node(size_type s, Args &&...args) :
+            element(std::forward<Args>(args)...), slot{s} {
+        }
+
+        ElementType element;
+        size_type slot;
+    };
+
+    // 空闲槽位通过 nextFree 串成链表，归还槽位不需要申请内存
+    struct __Slot {
+        size_type position;
+        size_type generation;
+        size_type nextFree;
+    };
+
+    size_type __position(Handle handle) const;
+    size_type __acquireSlot();
+    void __releaseSlot(size_type slot) noexcept;
+    template <typename Element>
+    void __updatePriority(Handle handle, Element &&e);
+    void __reshape(size_type position);
+    ElementType __removeAt(size_type position);
+
+    std::vector<__Node> __heap;
+    std::vector<__Slot> __slots;
+    size_type __firstFree{__NPOS};
+    Compare __compare;
+};
+
+template <typename ElementType, std::size_t Arity, typename Compare>
+IndexedPQType<ElementType, Arity, Compare>::IndexedPQType(const Compare &compare) :
+    __heap{}, __slots{}, __compare{compare} {
+}
+
+template <typename ElementType, std::size_t Arity, typename Compare>
+IndexedPQType<ElementType, Arity, Compare>::IndexedPQType(IndexedPQType &&other) noexcept :
+    __heap{std::move(other.__heap)},
+    __slots{std::move(other.__slots)},
+    __firstFree{std::exchange(other.__firstFree, __NPOS)},
+    __compare{std::move(other.__compare)} {
+    other.__heap.clear();
+    other.__slots.clear();
+}
+
+template <typename ElementType, std::size_t Arity, typename Compare>
+auto IndexedPQType<ElementType, Arity, Compare>::operator=(IndexedPQType &&other) noexcept -> IndexedPQType & {
+    if (this != &other) {
+        __heap = std::move(other.__heap);
+        __slots = std::move(other.__slots);
+        __firstFree = std::exchange(other.__firstFree, __NPOS);
+        __compare = std::move(other.__compare);
+        other.__heap.clear();
+        other.__slots.clear();
+    }
+    return *this;
+}
+
+/**
+ * @description: 将队列置空，之前返回的句柄全部失效
+ * @return      {void}
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+void IndexedPQType<ElementType, Arity, Compare>::makeEmpty() noexcept {
+    for (const __Node &node : __heap) {
+        __releaseSlot(node.slot);
+    }
+    __heap.clear();
+}
+
+/**
+ * @description: 检查队列是否为空
+ * @return      {bool} 若为空返回 true，否则返回 false
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+[[nodiscard]] bool IndexedPQType<ElementType, Arity, Compare>::isEmpty() const noexcept {
+    return __heap.empty();
+}
+
+/**
+ * @description: 获取队列中元素的个数
+ * @return      {size_type} 元素个数
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+[[nodiscard]] auto IndexedPQType<ElementType, Arity, Compare>::size() const noexcept -> size_type {
+    return __heap.size();
+}
+
+/**
+ * @description: 检查句柄指向的元素是否仍在队列中
+ * @param       {Handle} handle 元素的句柄
+ * @return      {bool} 若仍在队列中返回 true，否则返回 false
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+[[nodiscard]] bool IndexedPQType<ElementType, Arity, Compare>::contains(Handle handle) const noexcept {
+    return handle.__slot < __slots.size() && __slots[handle.__slot].generation == handle.__generation &&
+           __slots[handle.__slot].position != __NPOS;
+}
+
+/**
+ * @description: 查看句柄指向的元素
+ * @param       {Handle} handle 元素的句柄
+ * @return      {const ElementType &} 句柄指向的元素
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+[[nodiscard]] const ElementType &IndexedPQType<ElementType, Arity, Compare>::get(Handle handle) const {
+    return __heap[__position(handle)].element;
+}
+
+/**
+ * @description: 查看优先级最高的元素，不出队
+ * @return      {const ElementType &} 队列中优先级最高的元素
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+[[nodiscard]] const ElementType &IndexedPQType<ElementType, Arity, Compare>::top() const {
+    if (isEmpty()) {
+        throw QueueException("queue empty!");
+    }
+    return __heap.front().element;
+}
+
+/**
+ * @description: 获取优先级最高的元素的句柄
+ * @return      {Handle} 队列中优先级最高的元素的句柄
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+[[nodiscard]] auto IndexedPQType<ElementType, Arity, Compare>::topHandle() const -> Handle {
+    if (isEmpty()) {
+        throw QueueException("queue empty!");
+    }
+    size_type slot{__heap.front().slot};
+    return Handle{slot, __slots[slot].generation};
+}
+
+/**
+ * @description: 元素入队
+ * @param       {ElementType} e 要插入的元素
+ * @return      {Handle} 新元素的句柄
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+auto IndexedPQType<ElementType, Arity, Compare>::enqueue(const ElementType &e) -> Handle {
+    return emplace(e);
+}
+
+/**
+ * @description: 元素入队，移动 e 而不拷贝
+ * @param       {ElementType} e 要插入的元素
+ * @return      {Handle} 新元素的句柄
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+auto IndexedPQType<ElementType, Arity, Compare>::enqueue(ElementType &&e) -> Handle {
+    return emplace(std::move(e));
+}
+
+/**
+ * @description: 用 args 直接构造元素后入队
+ * @param       {Args &&...} args 元素构造函数的参数
+ * @return      {Handle} 新元素的句柄
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+template <typename... Args>
+auto IndexedPQType<ElementType, Arity, Compare>::emplace(Args &&...args) -> Handle {
+    size_type slot{__acquireSlot()};
+    try {
+        __heap.emplace_back(slot, std::forward<Args>(args)...);
+    } catch (const std::bad_alloc &) {
+        __releaseSlot(slot);
+        throw QueueException("queue full!");
+    } catch (...) {
+        __releaseSlot(slot);
+        throw;
+    }
+    __slots[slot].position = __heap.size() - 1;
+    __reshape(__heap.size() - 1);
+    return Handle{slot, __slots[slot].generation};
+}
+
+/**
+ * @description: 优先级最高的元素出队，其句柄随之失效
+ * @return      {ElementType} 队列中优先级最高的元素
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+ElementType IndexedPQType<ElementType, Arity, Compare>::dequeue() {
+    if (isEmpty()) {
+        throw QueueException("queue empty!");
+    }
+    return __removeAt(0);
+}
+
+/**
+ * @description: 将句柄指向的元素替换为 e，并根据优先级升高或降低向上或向下调整
+ * @param       {Handle} handle 元素的句柄
+ * @param       {ElementType} e 新的元素
+ * @return      {void}
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+void IndexedPQType<ElementType, Arity, Compare>::updatePriority(Handle handle, const ElementType &e) {
+    __updatePriority(handle, e);
+}
+
+/**
+ * @description: 将句柄指向的元素替换为 e，并根据优先级升高或降低向上或向下调整
+ * @param       {Handle} handle 元素的句柄
+ * @param       {ElementType} e 新的元素
+ * @return      {void}
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+void IndexedPQType<ElementType, Arity, Compare>::updatePriority(Handle handle, ElementType &&e) {
+    __updatePriority(handle, std::move(e));
+}
+
+/**
+ * @description: 删除句柄指向的元素，其句柄随之失效
+ * @param       {Handle} handle 元素的句柄
+ * @return      {ElementType} 被删除的元素
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+ElementType IndexedPQType<ElementType, Arity, Compare>::erase(Handle handle) {
+    return __removeAt(__position(handle));
+}
+
+template <typename ElementType, std::size_t Arity, typename Compare>
+auto IndexedPQType<ElementType, Arity, Compare>::__position(Handle handle) const -> size_type {
+    if (!contains(handle)) {
+        throw QueueException("invalid handle!");
+    }
+    return __slots[handle.__slot].position;
+}
+
+template <typename ElementType, std::size_t Arity, typename Compare>
+auto IndexedPQType<ElementType, Arity, Compare>::__acquireSlot() -> size_type {
+    if (__firstFree != __NPOS) {
+        size_type slot{__firstFree};
+        __firstFree = __slots[slot].nextFree;
+        return slot;
+    }
+    try {
+        __slots.push_back(__Slot{__NPOS, 0, __NPOS});
+    } catch (const std::bad_alloc &) {
+        throw QueueException("queue full!");
+    }
+    return __slots.size() - 1;
+}
+
+template <typename ElementType, std::size_t Arity, typename Compare>
+void IndexedPQType<ElementType, Arity, Compare>::__releaseSlot(size_type slot) noexcept {
+    __slots[slot].position = __NPOS;
+    ++__slots[slot].generation;
+    __slots[slot].nextFree = __firstFree;
+    __firstFree = slot;
+}
+
+template <typename ElementType, std::size_t Arity, typename Compare>
+template <typename Element>
+void IndexedPQType<ElementType, Arity, Compare>::__updatePriority(Handle handle, Element &&e) {
+    size_type position{__position(handle)};
+    __heap[position].element = std::forward<Element>(e);
+    __reshape(position);
+}
+
+/**
+ * @description: __heap[position] 的优先级改变后，若高于父节点则向上调整，否则向下调整
+ * @return      {void}
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+void IndexedPQType<ElementType, Arity, Compare>::__reshape(size_type position) {
+    auto nodeCompare{[this](const __Node &lhs, const __Node &rhs) { return __compare(lhs.element, rhs.element); }};
+    auto observer{[this](size_type index) { __slots[__heap[index].slot].position = index; }};
+    if (0 < position && nodeCompare(__heap[__detail::__heapParent<Arity>(position)], __heap[position])) {
+        __detail::__reshapeUp<Arity>(__heap.begin(), 0, position, nodeCompare, observer);
+    } else {
+        __detail::__reshapeDown<Arity>(__heap.begin(), position, __heap.size() - 1, nodeCompare, observer);
+    }
+}
+
+/**
+ * @description: 删除 __heap[position]，用最后一个元素填补后重新调整
+ * @return      {ElementType} 被删除的元素
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+ElementType IndexedPQType<ElementType, Arity, Compare>::__removeAt(size_type position) {
+    ElementType e(std::move(__heap[position].element));
+    __releaseSlot(__heap[position].slot);
+    if (position + 1 != __heap.size()) {
+        __heap[position] = std::move(__heap.back());
+        __slots[__heap[position].slot].position = position;
+        __heap.pop_back();
+        __reshape(position);
+    } else {
+        __heap.pop_back();
+    }
+    return e;
+}
+
+} // namespace dsa
+
+#endif
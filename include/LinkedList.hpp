@@ -0,0 +1,841 @@
+#ifndef __LINKED_LIST_H__
+#define __LINKED_LIST_H__
+
+#include "StaticList.hpp"
+#include "format.hpp"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 17:35:20
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 17:35:20
+ * @FilePath     : /include/LinkedList.hpp
+ * @Description  : List 的双向循环链表实现，以内嵌的哨兵节点作为头尾，空表无需特殊处理。
+ *                 节点从 Pool 的空闲链表中分配，Pool 按批向堆申请节点，之后通过迭代器插入、删除都是 O(1) 且不调用 malloc。
+ *                 多个链表可以共享同一个 Pool，共享 Pool 的链表之间 splice 只需修改指针，为 O(1)。
+ *                 Pool 不是线程安全的，共享同一个 Pool 的链表只能在同一线程中修改
+ */
+template <typename ElementType>
+class LinkedList final : public StaticList<LinkedList<ElementType>> {
+    struct __NodeBase {
+        __NodeBase *prev;
+        __NodeBase *next;
+    };
+    struct __Node : __NodeBase {
+        alignas(ElementType) unsigned char storage[sizeof(ElementType)];
+
+        ElementType *value() noexcept {
+            return std::launder(reinterpret_cast<ElementType *>(storage));
+        }
+    };
+
+    template <typename T>
+    class __Iterator {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<T>;
+        using pointer = T *;
+        using reference = T &;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        __Iterator() noexcept :
+            __node{nullptr} {
+        }
+        // 非 const 迭代器可以隐式转换为 const 迭代器
+        template <typename U, typename = std::enable_if_t<std::is_const_v<T> && std::is_same_v<U, value_type>>>
+        __Iterator(const __Iterator<U> &rhs) noexcept :
+            __node{rhs.__node} {
+        }
+
+        reference operator*() const noexcept {
+            return *static_cast<__Node *>(__node)->value();
+        }
+        pointer operator->() const noexcept {
+            return static_cast<__Node *>(__node)->value();
+        }
+        __Iterator &operator++() noexcept {
+            __node = __node->next;
+            return *this;
+        }
+        __Iterator operator++(int) noexcept {
+            __Iterator old{*this};
+            __node = __node->next;
+            return old;
+        }
+        __Iterator &operator--() noexcept {
+            __node = __node->prev;
+            return *this;
+        }
+        __Iterator operator--(int) noexcept {
+            __Iterator old{*this};
+            __node = __node->prev;
+            return old;
+        }
+        friend bool operator==(const __Iterator &lhs, const __Iterator &rhs) noexcept {
+            return lhs.__node == rhs.__node;
+        }
+        friend bool operator!=(const __Iterator &lhs, const __Iterator &rhs) noexcept {
+            return lhs.__node != rhs.__node;
+        }
+
+    private:
+        friend class LinkedList;
+        template <typename>
+        friend class __Iterator;
+
+        __NodeBase *__node;
+
+        explicit __Iterator(__NodeBase *node) noexcept :
+            __node{node} {
+        }
+    };
+
+public:
+    using size_type = typename StaticList<LinkedList>::size_type;
+    using value_type = ElementType;
+    using iterator = __Iterator<ElementType>;
+    using const_iterator = __Iterator<const ElementType>;
+
+    /*
+     * 链表节点池。节点按批申请，每批的节点数从 initialBatchSize 开始倍增，上限为 MAX_BATCH_SIZE；
+     * 释放的节点挂回空闲链表，直到 Pool 析构才归还给堆
+     */
+    class Pool {
+    public:
+        inline static constexpr size_type MAX_BATCH_SIZE{4096};
+
+        explicit Pool(size_type initialBatchSize = 32);
+        Pool(const Pool &) = delete;
+        Pool &operator=(const Pool &) = delete;
+        ~Pool();
+
+        /**
+         * @description: 获取池中节点总数（已分配的和空闲的）
+         * @return      {size_type} 节点总数
+         */
+        [[nodiscard]] size_type capacity() const noexcept;
+
+        /**
+         * @description: 获取空闲节点数
+         * @return      {size_type} 空闲节点数
+         */
+        [[nodiscard]] size_type available() const noexcept;
+
+        /**
+         * @description: 预先申请节点，保证至少有 count 个空闲节点
+         * @param       {size_type} count 需要的空闲节点数
+         * @return      {void}
+         */
+        void reserve(size_type count);
+
+    private:
+        friend class LinkedList;
+
+        std::vector<std::pair<__Node *, size_type>> __batches;
+        __NodeBase *__freeList;
+        size_type __available;
+        size_type __capacity;
+        size_type __nextBatchSize;
+
+        __Node *__allocate();
+        void __deallocate(__Node *node) noexcept;
+        void __addBatch(size_type count);
+    };
+
+    /**
+     * @description: 创建使用独立节点池的链表
+     */
+    LinkedList();
+    /**
+     * @description: 创建使用指定节点池的链表
+     * @param       {std::shared_ptr<Pool>} pool 节点池，不能为空
+     */
+    explicit LinkedList(std::shared_ptr<Pool> pool);
+    LinkedList(const LinkedList &) = delete;
+    /**
+     * @description: 移动构造，接管 rhs 的全部节点并共享其节点池，O(1)
+     */
+    LinkedList(LinkedList &&rhs) noexcept;
+    LinkedList &operator=(const LinkedList &) = delete;
+    LinkedList &operator=(LinkedList &&rhs) noexcept;
+    ~LinkedList();
+
+    /**
+     * @description: 清除集合中的所有元素，节点归还给节点池
+     * @return      {void}
+     */
+    void clear() noexcept;
+
+    /**
+     * @description: 获取集合中元素数量
+     * @return      {size_type} 集合中元素的数量
+     */
+    [[nodiscard]] size_type size() const noexcept;
+
+    /**
+     * @description: 检查集合是否有元素
+     * @return      {bool} 无元素返回 true，有元素返回 false
+     */
+    [[nodiscard]] bool isEmpty() const noexcept;
+
+    /**
+     * @description: 往集合末尾插入元素，O(1)
+     * @param       {const ElementType &} element 需要插入的元素
+     * @return      {void}
+     */
+    void add(const ElementType &element);
+    void add(ElementType &&element);
+
+    /**
+     * @description: 在集合指定位置处插入元素，需要从较近的一端走到 index，O(min(index, size() - index))
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {const ElementType &} element 要插入的元素
+     * @return      {void}
+     */
+    void add(size_type index, const ElementType &element);
+    void add(size_type index, ElementType &&element);
+
+    /**
+     * @description: 往集合开头插入元素，O(1)
+     * @param       {const ElementType &} element 需要插入的元素
+     * @return      {void}
+     */
+    void addFirst(const ElementType &element);
+    void addFirst(ElementType &&element);
+
+    /**
+     * @description: 获取集合指定位置处的元素，O(min(index, size() - index))
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {const ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] const ElementType &get(size_type index) const;
+
+    /**
+     * @description: 不做索引检查地访问集合指定位置处的元素，调用方保证 index < size()
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] ElementType &getUnchecked(size_type index) noexcept;
+    [[nodiscard]] const ElementType &getUnchecked(size_type index) const noexcept;
+
+    /**
+     * @description: 获取集合的第一个、最后一个元素，O(1)
+     * @return      {const ElementType &} 第一个、最后一个元素，集合为空时抛出 std::out_of_range
+     */
+    [[nodiscard]] const ElementType &getFirst() const;
+    [[nodiscard]] const ElementType &getLast() const;
+
+    /**
+     * @description: 将集合指定位置处的元素设置为指定元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @param       {const ElementType &} element 要设置的元素
+     * @return      {ElementType} 设置之前的元素
+     */
+    ElementType set(size_type index, const ElementType &element);
+    ElementType set(size_type index, ElementType &&element);
+
+    /**
+     * @description: 删除集合指定位置处的元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType} 被删除的元素
+     */
+    ElementType remove(size_type index);
+
+    /**
+     * @description: 删除集合的第一个、最后一个元素，O(1)
+     * @return      {ElementType} 被删除的元素，集合为空时抛出 std::out_of_range
+     */
+    ElementType removeFirst();
+    ElementType removeLast();
+
+    /**
+     * @description: 在集合中获取指定元素的位置索引
+     * @param       {const ElementType &} element 指定元素
+     * @return      {size_type} 指定元素所在的位置索引，未找到则返回 npos
+     */
+    [[nodiscard]] size_type indexOf(const ElementType &element) const;
+
+    /**
+     * @description: 按顺序访问集合中的所有元素
+     * @param       {Function} function 对每个元素调用的方法
+     * @return      {void}
+     */
+    template <typename Function>
+    void forEach(Function function) const;
+
+    /**
+     * @description: 将集合转换为字符串表示，可用于打印等
+     * @param       {function<std::string(const ElementType &)>} toString 将集合中元素转换为字符串的方法
+     * @return      {string} 集合的字符串表示
+     */
+    [[nodiscard]] std::string toString(std::function<std::string(const ElementType &)> toString) const;
+
+    /**
+     * @description: 按迭代器顺序格式化集合，避免 StaticList 默认实现按索引访问带来的 O(n^2)
+     * @param       {OutputIt} out 字符输出迭代器
+     * @param       {Formatter} formatter 元素格式化方法
+     * @return      {OutputIt} 写入后的输出迭代器
+     */
+    template <typename OutputIt, typename Formatter = DefaultFormatter>
+    OutputIt formatTo(OutputIt out, Formatter formatter = Formatter{}) const;
+
+    /**
+     * @description: 在 pos 之前用参数直接构造元素，O(1)
+     * @param       {const_iterator} pos 插入位置
+     * @param       {Args &&...} args 元素构造参数
+     * @return      {iterator} 指向新元素的迭代器
+     */
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args);
+
+    /**
+     * @description: 在 pos 之前插入元素，O(1)
+     * @param       {const_iterator} pos 插入位置
+     * @param       {const ElementType &} element 要插入的元素
+     * @return      {iterator} 指向新元素的迭代器
+     */
+    iterator insert(const_iterator pos, const ElementType &element);
+    iterator insert(const_iterator pos, ElementType &&element);
+
+    /**
+     * @description: 删除 pos 指向的元素，O(1)，只有指向被删除元素的迭代器失效
+     * @param       {const_iterator} pos 要删除的元素，不能为 end()
+     * @return      {iterator} 被删除元素的下一个位置
+     */
+    iterator erase(const_iterator pos) noexcept;
+
+    /**
+     * @description: 删除 [first, last) 中的元素，O(last - first)
+     * @return      {iterator} last
+     */
+    iterator erase(const_iterator first, const_iterator last) noexcept;
+
+    /**
+     * @description: 将 other 的全部元素移动到 pos 之前。共享节点池时只修改指针，O(1)；
+     *               否则逐个移动元素到本链表的节点池，O(other.size())。other 不能是本链表
+     * @param       {const_iterator} pos 插入位置
+     * @param       {LinkedList &} other 源链表，结束后为空
+     * @return      {void}
+     */
+    void splice(const_iterator pos, LinkedList &other);
+
+    /**
+     * @description: 将 other 中 it 指向的元素移动到 pos 之前，共享节点池时 O(1)。other 可以是本链表
+     * @param       {const_iterator} pos 插入位置
+     * @param       {LinkedList &} other 源链表
+     * @param       {const_iterator} it 要移动的元素
+     * @return      {void}
+     */
+    void splice(const_iterator pos, LinkedList &other, const_iterator it);
+
+    /**
+     * @description: 将 other 中 [first, last) 的元素移动到 pos 之前。共享节点池时只修改指针，
+     *               但 other 不是本链表时需要 O(last - first) 统计元素个数。other 是本链表时 pos 不能在 [first, last) 中
+     * @param       {const_iterator} pos 插入位置
+     * @param       {LinkedList &} other 源链表
+     * @param       {const_iterator} first 范围起始
+     * @param       {const_iterator} last 范围末尾
+     * @return      {void}
+     */
+    void splice(const_iterator pos, LinkedList &other, const_iterator first, const_iterator last);
+
+    /**
+     * @description: 获取链表使用的节点池，可用于创建共享节点池的链表
+     * @return      {const std::shared_ptr<Pool> &} 节点池
+     */
+    [[nodiscard]] const std::shared_ptr<Pool> &pool() const noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+private:
+    using __Base = StaticList<LinkedList>;
+    using __ListOperation = typename __Base::_Operation;
+
+    std::shared_ptr<Pool> __pool;
+    __NodeBase __sentinel;
+    size_type __size;
+
+    __NodeBase *__head() const noexcept;
+    __NodeBase *__nodeAt(size_type index) const noexcept;
+    /**
+     * @description: 接管 rhs 的全部节点，调用前本链表必须为空
+     * @return      {void}
+     */
+    void __steal(LinkedList &rhs) noexcept;
+    /**
+     * @description: 将首尾为 first、last 的节点链接到 pos 之前
+     * @return      {void}
+     */
+    static void __link(__NodeBase *pos, __NodeBase *first, __NodeBase *last) noexcept;
+    /**
+     * @description: 将首尾为 first、last 的节点从所在链表中摘下
+     * @return      {void}
+     */
+    static void __unlink(__NodeBase *first, __NodeBase *last) noexcept;
+    void __destroyNode(__NodeBase *node) noexcept;
+    template <typename T>
+    ElementType __set(size_type index, T &&element);
+    ElementType __take(__NodeBase *node);
+};
+
+template <typename ElementType>
+LinkedList<ElementType>::Pool::Pool(size_type initialBatchSize) :
+    __batches{}, __freeList{nullptr}, __available{0}, __capacity{0}, __nextBatchSize{std::max<size_type>(initialBatchSize, 1)} {
+}
+
+template <typename ElementType>
+LinkedList<ElementType>::Pool::~Pool() {
+    for (auto &[nodes, count] : __batches) {
+        std::allocator<__Node>{}.deallocate(nodes, count);
+    }
+}
+
+template <typename ElementType>
+[[nodiscard]] typename LinkedList<ElementType>::size_type LinkedList<ElementType>::Pool::capacity() const noexcept {
+    return __capacity;
+}
+
+template <typename ElementType>
+[[nodiscard]] typename LinkedList<ElementType>::size_type LinkedList<ElementType>::Pool::available() const noexcept {
+    return __available;
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::Pool::reserve(size_type count) {
+    if (count > __available) {
+        __addBatch(count - __available);
+    }
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::__Node *LinkedList<ElementType>::Pool::__allocate() {
+    if (__freeList == nullptr) {
+        __addBatch(__nextBatchSize);
+        __nextBatchSize = std::min(__nextBatchSize * 2, MAX_BATCH_SIZE);
+    }
+    __NodeBase *node{__freeList};
+    __freeList = node->next;
+    --__available;
+    return static_cast<__Node *>(node);
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::Pool::__deallocate(__Node *node) noexcept {
+    node->next = __freeList;
+    __freeList = node;
+    ++__available;
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::Pool::__addBatch(size_type count) {
+    __batches.reserve(__batches.size() + 1);
+    __Node *nodes{std::allocator<__Node>{}.allocate(count)};
+    __batches.emplace_back(nodes, count);
+    // 倒序挂入空闲链表，使分配顺序与内存顺序一致
+    for (size_type i = count; i > 0; --i) {
+        __Node *node{::new (static_cast<void *>(nodes + i - 1)) __Node};
+        node->next = __freeList;
+        __freeList = node;
+    }
+    __available += count;
+    __capacity += count;
+}
+
+template <typename ElementType>
+LinkedList<ElementType>::LinkedList() :
+    LinkedList(std::make_shared<Pool>()) {
+}
+
+template <typename ElementType>
+LinkedList<ElementType>::LinkedList(std::shared_ptr<Pool> pool) :
+    __pool{std::move(pool)}, __sentinel{&__sentinel, &__sentinel}, __size{0} {
+    if (!__pool) {
+        throw std::invalid_argument{"LinkedList: pool must not be null"};
+    }
+}
+
+template <typename ElementType>
+LinkedList<ElementType>::LinkedList(LinkedList &&rhs) noexcept :
+    __pool{rhs.__pool}, __sentinel{&__sentinel, &__sentinel}, __size{0} {
+    __steal(rhs);
+}
+
+template <typename ElementType>
+LinkedList<ElementType> &LinkedList<ElementType>::operator=(LinkedList &&rhs) noexcept {
+    if (this != &rhs) {
+        clear();
+        // 节点属于 rhs 的节点池，接管节点的同时必须共享该节点池
+        __pool = rhs.__pool;
+        __steal(rhs);
+    }
+    return *this;
+}
+
+template <typename ElementType>
+LinkedList<ElementType>::~LinkedList() {
+    clear();
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::clear() noexcept {
+    erase(cbegin(), cend());
+}
+
+template <typename ElementType>
+[[nodiscard]] typename LinkedList<ElementType>::size_type LinkedList<ElementType>::size() const noexcept {
+    return __size;
+}
+
+template <typename ElementType>
+[[nodiscard]] bool LinkedList<ElementType>::isEmpty() const noexcept {
+    return __size == 0;
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::add(const ElementType &element) {
+    emplace(cend(), element);
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::add(ElementType &&element) {
+    emplace(cend(), std::move(element));
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::add(size_type index, const ElementType &element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, __size);
+    emplace(const_iterator{__nodeAt(index)}, element);
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::add(size_type index, ElementType &&element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, __size);
+    emplace(const_iterator{__nodeAt(index)}, std::move(element));
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::addFirst(const ElementType &element) {
+    emplace(cbegin(), element);
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::addFirst(ElementType &&element) {
+    emplace(cbegin(), std::move(element));
+}
+
+template <typename ElementType>
+[[nodiscard]] const ElementType &LinkedList<ElementType>::get(size_type index) const {
+    __Base::template _checkIndex<__ListOperation::GET>(index, __size);
+    return getUnchecked(index);
+}
+
+template <typename ElementType>
+[[nodiscard]] ElementType &LinkedList<ElementType>::getUnchecked(size_type index) noexcept {
+    return *static_cast<__Node *>(__nodeAt(index))->value();
+}
+
+template <typename ElementType>
+[[nodiscard]] const ElementType &LinkedList<ElementType>::getUnchecked(size_type index) const noexcept {
+    return *static_cast<__Node *>(__nodeAt(index))->value();
+}
+
+template <typename ElementType>
+[[nodiscard]] const ElementType &LinkedList<ElementType>::getFirst() const {
+    __Base::template _checkIndex<__ListOperation::GET>(0, __size);
+    return *cbegin();
+}
+
+template <typename ElementType>
+[[nodiscard]] const ElementType &LinkedList<ElementType>::getLast() const {
+    __Base::template _checkIndex<__ListOperation::GET>(0, __size);
+    return *std::prev(cend());
+}
+
+template <typename ElementType>
+ElementType LinkedList<ElementType>::set(size_type index, const ElementType &element) {
+    return __set(index, element);
+}
+
+template <typename ElementType>
+ElementType LinkedList<ElementType>::set(size_type index, ElementType &&element) {
+    return __set(index, std::move(element));
+}
+
+template <typename ElementType>
+ElementType LinkedList<ElementType>::remove(size_type index) {
+    __Base::template _checkIndex<__ListOperation::REMOVE>(index, __size);
+    return __take(__nodeAt(index));
+}
+
+template <typename ElementType>
+ElementType LinkedList<ElementType>::removeFirst() {
+    __Base::template _checkIndex<__ListOperation::REMOVE>(0, __size);
+    return __take(__sentinel.next);
+}
+
+template <typename ElementType>
+ElementType LinkedList<ElementType>::removeLast() {
+    __Base::template _checkIndex<__ListOperation::REMOVE>(0, __size);
+    return __take(__sentinel.prev);
+}
+
+template <typename ElementType>
+[[nodiscard]] typename LinkedList<ElementType>::size_type LinkedList<ElementType>::indexOf(const ElementType &element) const {
+    size_type index{0};
+    for (const ElementType &e : *this) {
+        if (e == element) {
+            return index;
+        }
+        ++index;
+    }
+    return __Base::npos;
+}
+
+template <typename ElementType>
+template <typename Function>
+void LinkedList<ElementType>::forEach(Function function) const {
+    for (const ElementType &element : *this) {
+        function(element);
+    }
+}
+
+template <typename ElementType>
+[[nodiscard]] std::string LinkedList<ElementType>::toString(std::function<std::string(const ElementType &)> toString) const {
+    std::string result{};
+    formatTo(std::back_inserter(result), ToStringFormatter{std::move(toString)});
+    return result;
+}
+
+template <typename ElementType>
+template <typename OutputIt, typename Formatter>
+OutputIt LinkedList<ElementType>::formatTo(OutputIt out, Formatter formatter) const {
+    return formatRange(cbegin(), cend(), out, std::move(formatter));
+}
+
+template <typename ElementType>
+template <typename... Args>
+typename LinkedList<ElementType>::iterator LinkedList<ElementType>::emplace(const_iterator pos, Args &&...args) {
+    __Node *node{__pool->__allocate()};
+    try {
+        ::new (static_cast<void *>(node->storage)) ElementType(std::forward<Args>(args)...);
+    } catch (...) {
+        __pool->__deallocate(node);
+        throw;
+    }
+    __link(pos.__node, node, node);
+    ++__size;
+    return iterator{node};
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::iterator LinkedList<ElementType>::insert(const_iterator pos, const ElementType &element) {
+    return emplace(pos, element);
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::iterator LinkedList<ElementType>::insert(const_iterator pos, ElementType &&element) {
+    return emplace(pos, std::move(element));
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::iterator LinkedList<ElementType>::erase(const_iterator pos) noexcept {
+    __NodeBase *next{pos.__node->next};
+    __unlink(pos.__node, pos.__node);
+    __destroyNode(pos.__node);
+    --__size;
+    return iterator{next};
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::iterator LinkedList<ElementType>::erase(const_iterator first, const_iterator last) noexcept {
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator{last.__node};
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::splice(const_iterator pos, LinkedList &other) {
+    if (&other == this || other.isEmpty()) {
+        return;
+    }
+    if (__pool != other.__pool) {
+        for (ElementType &element : other) {
+            emplace(pos, std::move(element));
+        }
+        other.clear();
+        return;
+    }
+    __NodeBase *first{other.__sentinel.next};
+    __NodeBase *last{other.__sentinel.prev};
+    __unlink(first, last);
+    __link(pos.__node, first, last);
+    __size += std::exchange(other.__size, 0);
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::splice(const_iterator pos, LinkedList &other, const_iterator it) {
+    __NodeBase *node{it.__node};
+    if (pos.__node == node || pos.__node == node->next) {
+        return;
+    }
+    if (__pool != other.__pool) {
+        emplace(pos, std::move(*static_cast<__Node *>(node)->value()));
+        other.erase(it);
+        return;
+    }
+    __unlink(node, node);
+    __link(pos.__node, node, node);
+    --other.__size;
+    ++__size;
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::splice(const_iterator pos, LinkedList &other, const_iterator first, const_iterator last) {
+    if (first == last) {
+        return;
+    }
+    if (__pool != other.__pool) {
+        for (const_iterator it{first}; it != last; ++it) {
+            emplace(pos, std::move(*static_cast<__Node *>(it.__node)->value()));
+        }
+        other.erase(first, last);
+        return;
+    }
+    if (&other != this) {
+        auto count{static_cast<size_type>(std::distance(first, last))};
+        other.__size -= count;
+        __size += count;
+    }
+    __NodeBase *firstNode{first.__node};
+    __NodeBase *lastNode{last.__node->prev};
+    __unlink(firstNode, lastNode);
+    __link(pos.__node, firstNode, lastNode);
+}
+
+template <typename ElementType>
+[[nodiscard]] const std::shared_ptr<typename LinkedList<ElementType>::Pool> &LinkedList<ElementType>::pool() const noexcept {
+    return __pool;
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::iterator LinkedList<ElementType>::begin() noexcept {
+    return iterator{__sentinel.next};
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::iterator LinkedList<ElementType>::end() noexcept {
+    return iterator{&__sentinel};
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::const_iterator LinkedList<ElementType>::begin() const noexcept {
+    return const_iterator{__sentinel.next};
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::const_iterator LinkedList<ElementType>::end() const noexcept {
+    return const_iterator{__head()};
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::const_iterator LinkedList<ElementType>::cbegin() const noexcept {
+    return begin();
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::const_iterator LinkedList<ElementType>::cend() const noexcept {
+    return end();
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::__NodeBase *LinkedList<ElementType>::__head() const noexcept {
+    // 哨兵只在非 const 的修改操作中被改写，const 方法中仅作为 end() 的位置使用
+    return const_cast<__NodeBase *>(&__sentinel);
+}
+
+template <typename ElementType>
+typename LinkedList<ElementType>::__NodeBase *LinkedList<ElementType>::__nodeAt(size_type index) const noexcept {
+    __NodeBase *node{__head()};
+    if (index < __size / 2) {
+        for (size_type i = 0; i <= index; ++i) {
+            node = node->next;
+        }
+    } else {
+        for (size_type i = __size; i > index; --i) {
+            node = node->prev;
+        }
+    }
+    return node;
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::__steal(LinkedList &rhs) noexcept {
+    if (rhs.__size == 0) {
+        return;
+    }
+    __NodeBase *first{rhs.__sentinel.next};
+    __NodeBase *last{rhs.__sentinel.prev};
+    __unlink(first, last);
+    __link(&__sentinel, first, last);
+    __size = std::exchange(rhs.__size, 0);
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::__link(__NodeBase *pos, __NodeBase *first, __NodeBase *last) noexcept {
+    __NodeBase *prev{pos->prev};
+    prev->next = first;
+    first->prev = prev;
+    last->next = pos;
+    pos->prev = last;
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::__unlink(__NodeBase *first, __NodeBase *last) noexcept {
+    first->prev->next = last->next;
+    last->next->prev = first->prev;
+}
+
+template <typename ElementType>
+void LinkedList<ElementType>::__destroyNode(__NodeBase *node) noexcept {
+    auto realNode{static_cast<__Node *>(node)};
+    realNode->value()->~ElementType();
+    __pool->__deallocate(realNode);
+}
+
+template <typename ElementType>
+template <typename T>
+ElementType LinkedList<ElementType>::__set(size_type index, T &&element) {
+    __Base::template _checkIndex<__ListOperation::SET>(index, __size);
+    ElementType value(std::forward<T>(element));
+    std::swap(getUnchecked(index), value);
+    return value;
+}
+
+template <typename ElementType>
+ElementType LinkedList<ElementType>::__take(__NodeBase *node) {
+    ElementType old{std::move(*static_cast<__Node *>(node)->value())};
+    erase(const_iterator{node});
+    return old;
+}
+
+} // namespace dsa
+
+#endif
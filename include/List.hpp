@@ -15,7 +15,7 @@ namespace dsa {
  * @Author       : sphc
  * @Date         : 2023-10-19 13:54:08
  * @LastEditors  : sphc
- * @LastEditTime : 2023-10-21 13:58:15
+ * @LastEditTime : 2026-10-18 11:05:47
  * @FilePath     : /include/List.hpp
  * @Description  : List 集合接口
  */
@@ -60,6 +60,13 @@ public:
      */
     virtual void add(const ElementType &element) = 0;
 
+    /**
+     * @description: 往集合末尾插入元素，元素以移动方式放入集合
+     * @param       {ElementType &&} element 需要插入的元素
+     * @return      {void}
+     */
+    virtual void add(ElementType &&element) = 0;
+
     /**
      * @description: 在集合指定位置处插入元素
      * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
@@ -68,6 +75,14 @@ public:
      */
     virtual void add(size_type index, const ElementType &element) = 0;
 
+    /**
+     * @description: 在集合指定位置处插入元素，元素以移动方式放入集合
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {ElementType &&} element 要插入的元素
+     * @return      {void}
+     */
+    virtual void add(size_type index, ElementType &&element) = 0;
+
     /**
      * @description: 获取集合指定位置处的元素
      * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
@@ -83,6 +98,14 @@ public:
      */
     virtual ElementType set(size_type index, const ElementType &element) = 0;
 
+    /**
+     * @description: 将集合指定位置处的元素设置为指定元素，元素以移动方式放入集合
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @param       {ElementType &&} element 要设置的元素
+     * @return      {ElementType} 设置之前的元素
+     */
+    virtual ElementType set(size_type index, ElementType &&element) = 0;
+
     /**
      * @description: 删除集合指定位置处的元素
      * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
@@ -0,0 +1,113 @@
+#ifndef __LIST_ADAPTER_H__
+#define __LIST_ADAPTER_H__
+
+#include "AbstractList.hpp"
+#include <functional>
+#include <string>
+#include <utility>
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 16:48:03
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 16:48:03
+ * @FilePath     : /include/ListAdapter.hpp
+ * @Description  : 将基于 StaticList 的集合包装为虚接口 List，用于需要运行时多态（类型擦除）的场景
+ */
+template <typename ListImpl>
+class ListAdapter final : public AbstractList<typename ListImpl::value_type> {
+public:
+    using ElementType = typename ListImpl::value_type;
+    using size_type = typename AbstractList<ElementType>::size_type;
+
+    /**
+     * @description: 用参数构造被包装的集合
+     * @param       {Args &&...} args 集合的构造参数
+     */
+    template <typename... Args>
+    explicit ListAdapter(Args &&...args) :
+        __list(std::forward<Args>(args)...) {
+    }
+    ListAdapter(const ListAdapter &) = delete;
+    ListAdapter(ListAdapter &&) = delete;
+    ListAdapter &operator=(const ListAdapter &) = delete;
+    ListAdapter &operator=(ListAdapter &&) = delete;
+    ~ListAdapter() override = default;
+
+    void clear() override {
+        __list.clear();
+    }
+
+    [[nodiscard]] size_type size() const override {
+        return __list.size();
+    }
+
+    [[nodiscard]] bool isEmpty() const override {
+        return __list.isEmpty();
+    }
+
+    [[nodiscard]] bool contains(const ElementType &element) const override {
+        return __list.contains(element);
+    }
+
+    void add(const ElementType &element) override {
+        __list.add(element);
+    }
+
+    void add(ElementType &&element) override {
+        __list.add(std::move(element));
+    }
+
+    void add(size_type index, const ElementType &element) override {
+        __list.add(index, element);
+    }
+
+    void add(size_type index, ElementType &&element) override {
+        __list.add(index, std::move(element));
+    }
+
+    [[nodiscard]] const ElementType &get(size_type index) const override {
+        return __list.get(index);
+    }
+
+    ElementType set(size_type index, const ElementType &element) override {
+        return __list.set(index, element);
+    }
+
+    ElementType set(size_type index, ElementType &&element) override {
+        return __list.set(index, std::move(element));
+    }
+
+    ElementType remove(size_type index) override {
+        return __list.remove(index);
+    }
+
+    [[nodiscard]] size_type indexOf(const ElementType &element) const override {
+        return __list.indexOf(element);
+    }
+
+    [[nodiscard]] std::string toString(std::function<std::string(const ElementType &)> toString) const override {
+        return __list.toString(std::move(toString));
+    }
+
+    /**
+     * @description: 获取被包装的集合
+     * @return      {ListImpl &} 被包装的集合
+     */
+    [[nodiscard]] ListImpl &getList() noexcept {
+        return __list;
+    }
+
+    [[nodiscard]] const ListImpl &getList() const noexcept {
+        return __list;
+    }
+
+private:
+    ListImpl __list;
+};
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef __LIST_INDEX_CHECKER_H__
+#define __LIST_INDEX_CHECKER_H__
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 16:48:03
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 23:14:26
+ * @FilePath     : /include/ListIndexChecker.hpp
+ * @Description  : List 各操作的索引检查，由虚接口的 AbstractList 和静态分派的 StaticList 共用
+ */
+class ListIndexChecker {
+public:
+    using size_type = std::size_t;
+
+    enum class Operation;
+    template <Operation Op>
+    static void checkIndex(size_type index, size_type size);
+    /**
+     * @description: 检查区间 [from, to) 是否合法，要求 from <= to <= size
+     * @return      {void}
+     */
+    template <Operation Op>
+    static void checkRange(size_type from, size_type to, size_type size);
+    /**
+     * @description: 索引对指定操作是否合法，插入类操作允许 index == size，不需要索引的操作在编译期报错
+     * @return      {bool} 合法返回 true
+     */
+    template <Operation Op>
+    static constexpr bool isValidIndex(size_type index, size_type size) noexcept;
+    static constexpr bool isValidRange(size_type from, size_type to, size_type size) noexcept;
+
+private:
+    using _OperationName = const char *;
+    template <Operation Op>
+    static constexpr _OperationName __getOperationName() noexcept;
+    /**
+     * @description: 是否是需要传入索引参数的操作
+     * @return      {bool} 需要传入索引参数返回 true，否则返回 false
+     */
+    template <Operation Op>
+    static constexpr bool __isOperationWithIndex() noexcept;
+    // 出错路径标记为冷路径且不内联，检查本身只剩一次比较和一个很少跳转的分支
+    [[noreturn, gnu::cold, gnu::noinline]] static void __throwOutOfRangeException(_OperationName operation, size_type operatePos, size_type size);
+    [[noreturn, gnu::cold, gnu::noinline]] static void __throwOutOfRangeException(_OperationName operation, size_type from, size_type to, size_type size);
+};
+
+enum class ListIndexChecker::Operation {
+    CLEAR,
+    SIZE,
+    IS_EMPTY,
+    CONTAINS,
+    ADD,
+    ADD_BY_INDEX,
+    EMPLACE,
+    INSERT_RANGE,
+    REMOVE_RANGE,
+    GET,
+    SET,
+    REMOVE,
+    INDEX_OF,
+    TO_STRING
+};
+
+template <ListIndexChecker::Operation Op>
+constexpr ListIndexChecker::_OperationName ListIndexChecker::__getOperationName() noexcept {
+    if constexpr (Op == Operation::CLEAR) {
+        return "clear";
+    } else if constexpr (Op == Operation::SIZE) {
+        return "size";
+    } else if constexpr (Op == Operation::IS_EMPTY) {
+        return "isEmpty";
+    } else if constexpr (Op == Operation::CONTAINS) {
+        return "contains";
+    } else if constexpr (Op == Operation::ADD) {
+        return "add";
+    } else if constexpr (Op == Operation::ADD_BY_INDEX) {
+        return "add";
+    } else if constexpr (Op == Operation::EMPLACE) {
+        return "emplace";
+    } else if constexpr (Op == Operation::INSERT_RANGE) {
+        return "insertRange";
+    } else if constexpr (Op == Operation::REMOVE_RANGE) {
+        return "removeRange";
+    } else if constexpr (Op == Operation::GET) {
+        return "get";
+    } else if constexpr (Op == Operation::SET) {
+        return "set";
+    } else if constexpr (Op == Operation::REMOVE) {
+        return "remove";
+    } else if constexpr (Op == Operation::INDEX_OF) {
+        return "indexOf";
+    } else if constexpr (Op == Operation::TO_STRING) {
+        return "toString";
+    } else {
+        return "unknow";
+    }
+}
+
+template <ListIndexChecker::Operation Op>
+constexpr bool ListIndexChecker::__isOperationWithIndex() noexcept {
+    return Op == Operation::ADD_BY_INDEX || Op == Operation::EMPLACE || Op == Operation::INSERT_RANGE || Op == Operation::GET || Op == Operation::SET || Op == Operation::REMOVE;
+}
+
+template <ListIndexChecker::Operation Op>
+constexpr bool ListIndexChecker::isValidIndex(size_type index, size_type size) noexcept {
+    static_assert(__isOperationWithIndex<Op>(), "no index parameter need to be passed to the operation");
+    if constexpr (Op == Operation::ADD_BY_INDEX || Op == Operation::EMPLACE || Op == Operation::INSERT_RANGE) {
+        return index <= size;
+    } else {
+        return index < size;
+    }
+}
+
+constexpr bool ListIndexChecker::isValidRange(size_type from, size_type to, size_type size) noexcept {
+    return from <= to && to <= size;
+}
+
+template <ListIndexChecker::Operation Op>
+void ListIndexChecker::checkIndex(size_type index, size_type size) {
+    if (!isValidIndex<Op>(index, size)) {
+        __throwOutOfRangeException(__getOperationName<Op>(), index, size);
+    }
+}
+
+template <ListIndexChecker::Operation Op>
+void ListIndexChecker::checkRange(size_type from, size_type to, size_type size) {
+    if (!isValidRange(from, to, size)) {
+        __throwOutOfRangeException(__getOperationName<Op>(), from, to, size);
+    }
+}
+
+} // namespace dsa
+
+#endif
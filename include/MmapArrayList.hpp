@@ -0,0 +1,472 @@
+#ifndef __MMAP_ARRAY_LIST_H__
+#define __MMAP_ARRAY_LIST_H__
+
+#include "GrowthPolicy.hpp"
+#include "StaticList.hpp"
+#include "format.hpp"
+#include "mapped_file.hpp"
+#include "simd_search.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#ifdef DEBUG
+#include <cassert>
+#endif
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 21:38:02
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-21 10:26:18
+ * @FilePath     : /include/MmapArrayList.hpp
+ * @Description  : 持久化到文件的 List 数组实现，文件布局为 64 字节的头部（魔数、版本、元素大小、元素数量）加上连续的元素数组，
+ *                 整个文件以 MAP_SHARED 方式映射，重新打开时直接使用映射中的数据，无需逐个加载元素。
+ *                 修改直接写入映射，何时落盘由内核决定，需要保证持久化时调用 sync()。
+ *                 扩容通过 ftruncate + mremap 完成，扩容后之前取得的指针、引用和迭代器全部失效。
+ *                 被移动后的对象不再持有映射，只能销毁、被赋值或查询（size、capacity 均为 0），修改操作会抛出 std::system_error
+ */
+template <typename ElementType, typename GrowthPolicy = DefaultGrowthPolicy>
+class MmapArrayList final : public StaticList<MmapArrayList<ElementType, GrowthPolicy>> {
+    static_assert(std::is_trivially_copyable_v<ElementType>, "MmapArrayList only supports trivially copyable element types");
+    static_assert(alignof(ElementType) <= 64, "ElementType alignment must not exceed the 64 byte header");
+
+public:
+    using size_type = typename StaticList<MmapArrayList>::size_type;
+    using value_type = ElementType;
+    using iterator = ContiguousIterator<ElementType, MmapArrayList>;
+    using const_iterator = ContiguousIterator<const ElementType, MmapArrayList>;
+
+    inline static constexpr std::uint64_t MAGIC{0x5453494c50414d4dULL}; // "MMAPLIST"
+    inline static constexpr std::uint32_t VERSION{1};
+
+    /**
+     * @description: 打开（不存在时创建）指定的文件，文件头与当前元素类型不匹配时抛出 std::runtime_error，系统调用失败时抛出 std::system_error
+     * @param       {const std::string &} path 文件路径
+     */
+    explicit MmapArrayList(const std::string &path);
+    MmapArrayList(const MmapArrayList &) = delete;
+    MmapArrayList(MmapArrayList &&rhs) noexcept = default;
+    MmapArrayList &operator=(const MmapArrayList &) = delete;
+    MmapArrayList &operator=(MmapArrayList &&rhs) noexcept = default;
+    ~MmapArrayList() = default;
+
+    /**
+     * @description: 清除集合中的所有元素，文件大小不变
+     * @return      {void}
+     */
+    void clear();
+
+    /**
+     * @description: 获取集合中元素数量
+     * @return      {size_type} 集合中元素的数量
+     */
+    [[nodiscard]] size_type size() const;
+
+    /**
+     * @description: 检查集合是否有元素
+     * @return      {bool} 无元素返回 true，有元素返回 false
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * @description: 查找元素是否出现在集合中
+     * @param       {const ElementType &} element 需要查找的元素
+     * @return      {bool} 存在返回 true，不存在返回 false
+     */
+    [[nodiscard]] bool contains(const ElementType &element) const;
+
+    /**
+     * @description: 往集合末尾插入元素
+     * @param       {const ElementType &} element 需要插入的元素
+     * @return      {void}
+     */
+    void add(const ElementType &element);
+
+    /**
+     * @description: 在集合指定位置处插入元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {const ElementType &} element 要插入的元素
+     * @return      {void}
+     */
+    void add(size_type index, const ElementType &element);
+
+    /**
+     * @description: 将 [first, last) 中的元素依次追加到集合末尾，范围不能来自集合自身（扩容会重新映射）；
+     *               前向迭代器最多扩容一次并直接复制到映射中
+     * @param       {InputIterator} first 范围起始
+     * @param       {InputIterator} last 范围末尾
+     * @return      {void}
+     */
+    template <typename InputIterator>
+    void addAll(InputIterator first, InputIterator last);
+
+    /**
+     * @description: 获取集合指定位置处的元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {const ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] const ElementType &get(size_type index) const;
+
+    /**
+     * @description: 不做索引检查地访问集合指定位置处的元素，调用方保证 index < size()
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] ElementType &getUnchecked(size_type index) noexcept;
+    [[nodiscard]] const ElementType &getUnchecked(size_type index) const noexcept;
+
+    /**
+     * @description: 将集合指定位置处的元素设置为指定元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @param       {const ElementType &} element 要设置的元素
+     * @return      {ElementType} 设置之前的元素
+     */
+    ElementType set(size_type index, const ElementType &element);
+
+    /**
+     * @description: 删除集合指定位置处的元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType} 被删除的元素
+     */
+    ElementType remove(size_type index);
+
+    /**
+     * @description: 在集合中获取指定元素的位置索引
+     * @param       {const ElementType &} element 指定元素
+     * @return      {size_type} 指定元素所在的位置索引，未找到则返回 npos
+     */
+    [[nodiscard]] size_type indexOf(const ElementType &element) const;
+
+    /**
+     * @description: 将集合转换为字符串表示，可用于打印等
+     * @param       {function<std::string(const ElementType &)>} toString 将集合中元素转换为字符串的方法
+     * @return      {string} 集合的字符串表示
+     */
+    [[nodiscard]] std::string toString(std::function<std::string(const ElementType &)> toString) const;
+
+    /**
+     * @description: 获取文件当前能容纳的元素数量
+     * @return      {size_type} 集合容量
+     */
+    [[nodiscard]] size_type capacity() const;
+
+    /**
+     * @description: 将文件扩展到至少能容纳 capacity 个元素
+     * @param       {size_type} capacity 需要的容量
+     * @return      {void}
+     */
+    void reserve(size_type capacity);
+
+    /**
+     * @description: 截断文件中多余的容量，删除元素时不会自动缩小文件
+     * @return      {void}
+     */
+    void shrinkToFit();
+
+    /**
+     * @description: 将修改写回文件
+     * @param       {bool} async 为 true 时只发起写回，否则等待写回完成
+     * @return      {void}
+     */
+    void sync(bool async = false);
+
+    ElementType *data() noexcept;
+    const ElementType *data() const noexcept;
+    Span<ElementType> span() noexcept;
+    Span<const ElementType> span() const noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+private:
+    struct __Header {
+        std::uint64_t magic;
+        std::uint32_t version;
+        std::uint32_t elementSize;
+        std::uint64_t size;
+    };
+    inline static constexpr size_type __HEADER_BYTES{64};
+    static_assert(sizeof(__Header) <= __HEADER_BYTES);
+
+    MappedFile __file;
+
+    using __Base = StaticList<MmapArrayList>;
+    using __ListOperation = typename __Base::_Operation;
+
+    __Header *__header() const noexcept;
+    void __setSize(size_type size) noexcept;
+    void __resizeFile(size_type capacity);
+    void __ensureCapacity(size_type needCapacity);
+    static size_type __fileBytes(size_type capacity) noexcept;
+};
+
+template <typename ElementType, typename GrowthPolicy>
+MmapArrayList<ElementType, GrowthPolicy>::MmapArrayList(const std::string &path) :
+    __file{path, __fileBytes(GrowthPolicy::MIN_CAPACITY)} {
+    __Header *header{__header()};
+    if (__file.created()) {
+        header->magic = MAGIC;
+        header->version = VERSION;
+        header->elementSize = sizeof(ElementType);
+        header->size = 0;
+        return;
+    }
+    if (__file.size() < __HEADER_BYTES || header->magic != MAGIC) {
+        throw std::runtime_error{path + " is not a MmapArrayList file"};
+    }
+    if (header->version != VERSION) {
+        throw std::runtime_error{path + " has unsupported version " + std::to_string(header->version)};
+    }
+    if (header->elementSize != sizeof(ElementType)) {
+        throw std::runtime_error{path + " stores elements of " + std::to_string(header->elementSize) + " bytes, expected " + std::to_string(sizeof(ElementType))};
+    }
+    if (header->size > capacity()) {
+        throw std::runtime_error{path + " is truncated"};
+    }
+}
+
+template <typename ElementType, typename GrowthPolicy>
+void MmapArrayList<ElementType, GrowthPolicy>::clear() {
+    __setSize(0);
+}
+
+template <typename ElementType, typename GrowthPolicy>
+[[nodiscard]] typename MmapArrayList<ElementType, GrowthPolicy>::size_type MmapArrayList<ElementType, GrowthPolicy>::size() const {
+    const __Header *header{__header()};
+    return header == nullptr ? 0 : static_cast<size_type>(header->size);
+}
+
+template <typename ElementType, typename GrowthPolicy>
+[[nodiscard]] bool MmapArrayList<ElementType, GrowthPolicy>::isEmpty() const {
+    return size() == 0;
+}
+
+template <typename ElementType, typename GrowthPolicy>
+[[nodiscard]] bool MmapArrayList<ElementType, GrowthPolicy>::contains(const ElementType &element) const {
+    return indexOf(element) != __Base::npos;
+}
+
+template <typename ElementType, typename GrowthPolicy>
+void MmapArrayList<ElementType, GrowthPolicy>::add(const ElementType &element) {
+    // 扩容会重新映射，element 可能引用集合内部的元素，先复制出来
+    ElementType value{element};
+    size_type oldSize{size()};
+    __ensureCapacity(oldSize + 1);
+    data()[oldSize] = value;
+    __setSize(oldSize + 1);
+}
+
+template <typename ElementType, typename GrowthPolicy>
+void MmapArrayList<ElementType, GrowthPolicy>::add(size_type index, const ElementType &element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, size());
+    ElementType value{element};
+    size_type oldSize{size()};
+    __ensureCapacity(oldSize + 1);
+    ElementType *elements{data()};
+    std::memmove(static_cast<void *>(elements + index + 1), static_cast<const void *>(elements + index), (oldSize - index) * sizeof(ElementType));
+    elements[index] = value;
+    __setSize(oldSize + 1);
+}
+
+template <typename ElementType, typename GrowthPolicy>
+template <typename InputIterator>
+void MmapArrayList<ElementType, GrowthPolicy>::addAll(InputIterator first, InputIterator last) {
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>) {
+        size_type oldSize{size()};
+        auto count{static_cast<size_type>(std::distance(first, last))};
+        __ensureCapacity(oldSize + count);
+        std::copy(first, last, data() + oldSize);
+        __setSize(oldSize + count);
+    } else {
+        for (; first != last; ++first) {
+            add(*first);
+        }
+    }
+}
+
+template <typename ElementType, typename GrowthPolicy>
+[[nodiscard]] const ElementType &MmapArrayList<ElementType, GrowthPolicy>::get(size_type index) const {
+    __Base::template _checkIndex<__ListOperation::GET>(index, size());
+    return data()[index];
+}
+
+template <typename ElementType, typename GrowthPolicy>
+[[nodiscard]] ElementType &MmapArrayList<ElementType, GrowthPolicy>::getUnchecked(size_type index) noexcept {
+#ifdef DEBUG
+    assert(index < size());
+#endif
+    return data()[index];
+}
+
+template <typename ElementType, typename GrowthPolicy>
+[[nodiscard]] const ElementType &MmapArrayList<ElementType, GrowthPolicy>::getUnchecked(size_type index) const noexcept {
+#ifdef DEBUG
+    assert(index < size());
+#endif
+    return data()[index];
+}
+
+template <typename ElementType, typename GrowthPolicy>
+ElementType MmapArrayList<ElementType, GrowthPolicy>::set(size_type index, const ElementType &element) {
+    __Base::template _checkIndex<__ListOperation::SET>(index, size());
+    ElementType old{data()[index]};
+    data()[index] = element;
+    return old;
+}
+
+template <typename ElementType, typename GrowthPolicy>
+ElementType MmapArrayList<ElementType, GrowthPolicy>::remove(size_type index) {
+    __Base::template _checkIndex<__ListOperation::REMOVE>(index, size());
+    ElementType *elements{data()};
+    ElementType old{elements[index]};
+    std::memmove(static_cast<void *>(elements + index), static_cast<const void *>(elements + index + 1), (size() - index - 1) * sizeof(ElementType));
+    __setSize(size() - 1);
+    return old;
+}
+
+template <typename ElementType, typename GrowthPolicy>
+[[nodiscard]] typename MmapArrayList<ElementType, GrowthPolicy>::size_type MmapArrayList<ElementType, GrowthPolicy>::indexOf(const ElementType &element) const {
+    if constexpr (simd::is_searchable_v<ElementType>) {
+        size_type index{simd::findFirst(data(), size(), element)};
+        return index != size() ? index : __Base::npos;
+    } else {
+        auto it{std::find(cbegin(), cend(), element)};
+        return it != cend() ? it - cbegin() : __Base::npos;
+    }
+}
+
+template <typename ElementType, typename GrowthPolicy>
+[[nodiscard]] std::string MmapArrayList<ElementType, GrowthPolicy>::toString(std::function<std::string(const ElementType &)> toString) const {
+    std::string result{};
+    __Base::formatTo(std::back_inserter(result), ToStringFormatter{std::move(toString)});
+    return result;
+}
+
+template <typename ElementType, typename GrowthPolicy>
+[[nodiscard]] typename MmapArrayList<ElementType, GrowthPolicy>::size_type MmapArrayList<ElementType, GrowthPolicy>::capacity() const {
+    // 被移动后映射大小为 0
+    return __file.size() < __HEADER_BYTES ? 0 : (__file.size() - __HEADER_BYTES) / sizeof(ElementType);
+}
+
+template <typename ElementType, typename GrowthPolicy>
+void MmapArrayList<ElementType, GrowthPolicy>::reserve(size_type capacity) {
+    if (capacity > this->capacity()) {
+        __resizeFile(capacity);
+    }
+}
+
+template <typename ElementType, typename GrowthPolicy>
+void MmapArrayList<ElementType, GrowthPolicy>::shrinkToFit() {
+    size_type newCapacity{std::max(size(), GrowthPolicy::MIN_CAPACITY)};
+    if (newCapacity < capacity()) {
+        __resizeFile(newCapacity);
+    }
+}
+
+template <typename ElementType, typename GrowthPolicy>
+void MmapArrayList<ElementType, GrowthPolicy>::sync(bool async) {
+    __file.sync(async);
+}
+
+template <typename ElementType, typename GrowthPolicy>
+ElementType *MmapArrayList<ElementType, GrowthPolicy>::data() noexcept {
+    if (__file.data() == nullptr) {
+        return nullptr;
+    }
+    return reinterpret_cast<ElementType *>(static_cast<unsigned char *>(__file.data()) + __HEADER_BYTES);
+}
+
+template <typename ElementType, typename GrowthPolicy>
+const ElementType *MmapArrayList<ElementType, GrowthPolicy>::data() const noexcept {
+    if (__file.data() == nullptr) {
+        return nullptr;
+    }
+    return reinterpret_cast<const ElementType *>(static_cast<const unsigned char *>(__file.data()) + __HEADER_BYTES);
+}
+
+template <typename ElementType, typename GrowthPolicy>
+Span<ElementType> MmapArrayList<ElementType, GrowthPolicy>::span() noexcept {
+    return Span<ElementType>{data(), size()};
+}
+
+template <typename ElementType, typename GrowthPolicy>
+Span<const ElementType> MmapArrayList<ElementType, GrowthPolicy>::span() const noexcept {
+    return Span<const ElementType>{data(), size()};
+}
+
+template <typename ElementType, typename GrowthPolicy>
+typename MmapArrayList<ElementType, GrowthPolicy>::iterator MmapArrayList<ElementType, GrowthPolicy>::begin() noexcept {
+    return iterator{data()};
+}
+
+template <typename ElementType, typename GrowthPolicy>
+typename MmapArrayList<ElementType, GrowthPolicy>::iterator MmapArrayList<ElementType, GrowthPolicy>::end() noexcept {
+    return iterator{data() + size()};
+}
+
+template <typename ElementType, typename GrowthPolicy>
+typename MmapArrayList<ElementType, GrowthPolicy>::const_iterator MmapArrayList<ElementType, GrowthPolicy>::begin() const noexcept {
+    return const_iterator{data()};
+}
+
+template <typename ElementType, typename GrowthPolicy>
+typename MmapArrayList<ElementType, GrowthPolicy>::const_iterator MmapArrayList<ElementType, GrowthPolicy>::end() const noexcept {
+    return const_iterator{data() + size()};
+}
+
+template <typename ElementType, typename GrowthPolicy>
+typename MmapArrayList<ElementType, GrowthPolicy>::const_iterator MmapArrayList<ElementType, GrowthPolicy>::cbegin() const noexcept {
+    return begin();
+}
+
+template <typename ElementType, typename GrowthPolicy>
+typename MmapArrayList<ElementType, GrowthPolicy>::const_iterator MmapArrayList<ElementType, GrowthPolicy>::cend() const noexcept {
+    return end();
+}
+
+template <typename ElementType, typename GrowthPolicy>
+typename MmapArrayList<ElementType, GrowthPolicy>::__Header *MmapArrayList<ElementType, GrowthPolicy>::__header() const noexcept {
+    return static_cast<__Header *>(__file.data());
+}
+
+template <typename ElementType, typename GrowthPolicy>
+void MmapArrayList<ElementType, GrowthPolicy>::__setSize(size_type size) noexcept {
+    // 被移动后没有映射，此时只可能是 clear() 写入 0
+    if (__Header *header{__header()}; header != nullptr) {
+        header->size = size;
+    }
+}
+
+template <typename ElementType, typename GrowthPolicy>
+void MmapArrayList<ElementType, GrowthPolicy>::__resizeFile(size_type capacity) {
+    __file.resize(__fileBytes(capacity));
+}
+
+template <typename ElementType, typename GrowthPolicy>
+void MmapArrayList<ElementType, GrowthPolicy>::__ensureCapacity(size_type needCapacity) {
+    if (needCapacity > capacity()) {
+        __resizeFile(GrowthPolicy::grow(capacity(), needCapacity));
+    }
+}
+
+template <typename ElementType, typename GrowthPolicy>
+typename MmapArrayList<ElementType, GrowthPolicy>::size_type MmapArrayList<ElementType, GrowthPolicy>::__fileBytes(size_type capacity) noexcept {
+    return __HEADER_BYTES + capacity * sizeof(ElementType);
+}
+
+} // namespace dsa
+
+#endif
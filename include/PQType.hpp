@@ -4,7 +4,10 @@
 #include "QueueException.hpp"
 #include "heap_operation.hpp"
 #include <cassert>
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <new>
 #include <utility>
 #include <vector>
 
@@ -13,17 +16,25 @@ namespace dsa {
  * @Author       : sphc
  * @Date         : 2023-11-07 09:56:22
  * @LastEditors  : sphc
- * @LastEditTime : 2023-11-07 12:01:00
+ * @LastEditTime : 2026-10-21 10:58:44
  * @FilePath     : /include/PQType.hpp
- * @Description  : 优先队列，要求 ElementType 支持关系运算和赋值
+ * @Description  : 优先队列，要求 ElementType 支持移动构造和移动赋值。Arity 为底层堆的子节点数，较大的队列可以使用 4 叉或 8 叉堆。
+ *                 Compare 为严格弱序，compare(a, b) 为 true 表示 a 的优先级低于 b，默认 std::less 时最大的元素先出队，
+ *                 std::greater 时最小的元素先出队
  */
-template <typename ElementType>
+template <typename ElementType, std::size_t Arity = 2, typename Compare = std::less<ElementType>>
 class PQType {
 public:
     using size_type = std::size_t;
+    using value_type = ElementType;
+    using value_compare = Compare;
+
     PQType() = default;
+    explicit PQType(const Compare &compare);
     PQType(const PQType &) = default;
+    PQType(PQType &&) noexcept = default;
     PQType &operator=(const PQType &) = default;
+    PQType &operator=(PQType &&) noexcept = default;
 
     /**
      * @description: 将队列置空
@@ -35,29 +46,91 @@ public:
      * @return      {bool} 若为空返回 true，否则返回 false
      */
     [[nodiscard]] bool isEmpty() const noexcept;
+    /**
+     * @description: 获取队列中元素的个数
+     * @return      {size_type} 元素个数
+     */
+    [[nodiscard]] size_type size() const noexcept;
+    /**
+     * @description: 查看优先级最高的元素，不出队
+     * @return      {const ElementType &} 队列中优先级最高的元素
+     */
+    [[nodiscard]] const ElementType &top() const;
     /**
      * @description: 元素入队
      * @param       {ElementType} e 要插入的元素
      * @return      {void}
      */
     void enqueue(const ElementType &e);
+    /**
+     * @description: 元素入队，移动 e 而不拷贝
+     * @param       {ElementType} e 要插入的元素
+     * @return      {void}
+     */
+    void enqueue(ElementType &&e);
+    /**
+     * @description: 用 args 在队尾直接构造元素后入队
+     * @param       {Args &&...} args 元素构造函数的参数
+     * @return      {void}
+     */
+    template <typename... Args>
+    void emplace(Args &&...args);
+    /**
+     * @description: [first, last) 中的元素全部入队。先追加到队尾，新元素不少于原有元素时 O(n) 重新建堆，否则逐个向上调整
+     * @param       {InputIterator} first 第一个要插入的元素
+     * @param       {InputIterator} last 最后一个要插入的元素的下一个位置
+     * @return      {void}
+     */
+    template <typename InputIterator>
+    void enqueueAll(InputIterator first, InputIterator last);
     /**
      * @description: 优先级最高的元素出队
      * @return      {ElementType} 队列中优先级最高的元素
      */
     ElementType dequeue();
+    /**
+     * @description: 按优先级从高到低依次出队至多 k 个元素，写入 out
+     * @param       {size_type} k 最多出队的元素个数
+     * @param       {OutputIterator} out 出队元素的写入位置
+     * @return      {OutputIterator} 最后一个写入的元素的下一个位置
+     */
+    template <typename OutputIterator>
+    OutputIterator dequeueUpTo(size_type k, OutputIterator out);
+    /**
+     * @description: 用 e 替换优先级最高的元素，等价于 dequeue 后 enqueue(e)，但只做一次向下调整
+     * @param       {ElementType} e 要插入的元素
+     * @return      {ElementType} 被替换的原优先级最高的元素
+     */
+    ElementType replaceTop(const ElementType &e);
+    /**
+     * @description: 用 e 替换优先级最高的元素，等价于 dequeue 后 enqueue(std::move(e))，但只做一次向下调整
+     * @param       {ElementType} e 要插入的元素
+     * @return      {ElementType} 被替换的原优先级最高的元素
+     */
+    ElementType replaceTop(ElementType &&e);
 
 private:
     using ElementContainer = std::vector<ElementType>;
+
+    template <typename Element>
+    ElementType __replaceTop(Element &&e);
+    ElementType __popTop();
+
     ElementContainer __elements;
+    Compare __compare;
 };
 
+template <typename ElementType, std::size_t Arity, typename Compare>
+PQType<ElementType, Arity, Compare>::PQType(const Compare &compare) :
+    __elements{}, __compare{compare} {
+}
+
 /**
  * @description: 将队列置空
  * @return      {void}
  */
-template <typename ElementType>
-void PQType<ElementType>::makeEmpty() noexcept {
+template <typename ElementType, std::size_t Arity, typename Compare>
+void PQType<ElementType, Arity, Compare>::makeEmpty() noexcept {
     __elements.clear();
 }
 
@@ -65,41 +138,173 @@ void PQType<ElementType>::makeEmpty() noexcept {
  * @description: 检查队列是否为空
  * @return      {bool} 若为空返回 true，否则返回 false
  */
-template <typename ElementType>
-[[nodiscard]] bool PQType<ElementType>::isEmpty() const noexcept {
+template <typename ElementType, std::size_t Arity, typename Compare>
+[[nodiscard]] bool PQType<ElementType, Arity, Compare>::isEmpty() const noexcept {
     return __elements.empty();
 }
 
+/**
+ * @description: 获取队列中元素的个数
+ * @return      {size_type} 元素个数
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+[[nodiscard]] auto PQType<ElementType, Arity, Compare>::size() const noexcept -> size_type {
+    return __elements.size();
+}
+
+/**
+ * @description: 查看优先级最高的元素，不出队
+ * @return      {const ElementType &} 队列中优先级最高的元素
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+[[nodiscard]] const ElementType &PQType<ElementType, Arity, Compare>::top() const {
+    if (isEmpty()) {
+        throw QueueException("queue empty!");
+    }
+    return __elements.front();
+}
+
 /**
  * @description: 元素入队
  * @param       {ElementType} e 要插入的元素
  * @return      {void}
  */
-template <typename ElementType>
-void PQType<ElementType>::enqueue(const ElementType &e) {
+template <typename ElementType, std::size_t Arity, typename Compare>
+void PQType<ElementType, Arity, Compare>::enqueue(const ElementType &e) {
+    emplace(e);
+}
+
+/**
+ * @description: 元素入队，移动 e 而不拷贝
+ * @param       {ElementType} e 要插入的元素
+ * @return      {void}
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+void PQType<ElementType, Arity, Compare>::enqueue(ElementType &&e) {
+    emplace(std::move(e));
+}
+
+/**
+ * @description: 用 args 在队尾直接构造元素后入队
+ * @param       {Args &&...} args 元素构造函数的参数
+ * @return      {void}
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+template <typename... Args>
+void PQType<ElementType, Arity, Compare>::emplace(Args &&...args) {
     try {
-        __elements.push_back(e);
-    } catch (const std::bad_alloc &e) {
+        __elements.emplace_back(std::forward<Args>(args)...);
+    } catch (const std::bad_alloc &) {
         throw QueueException("queue full!");
     }
-    reshapeUp(__elements, 0, __elements.size() - 1);
+    reshapeUp<Arity>(__elements, 0, __elements.size() - 1, __compare);
 }
 
 /**
  * @description: 优先级最高的元素出队
  * @return      {ElementType} 队列中优先级最高的元素
  */
-template <typename ElementType>
-ElementType PQType<ElementType>::dequeue() {
+template <typename ElementType, std::size_t Arity, typename Compare>
+ElementType PQType<ElementType, Arity, Compare>::dequeue() {
     if (isEmpty()) {
         throw QueueException("queue empty!");
     }
-    ElementType e{std::move(__elements.front())};
-    __elements.front() = std::move(__elements.back());
-    __elements.pop_back();
-    if (!isEmpty()) {
-        reshapeDown(__elements, 0, __elements.size() - 1);
+    return __popTop();
+}
+
+/**
+ * @description: [first, last) 中的元素全部入队。先追加到队尾，新元素不少于原有元素时 O(n) 重新建堆，否则逐个向上调整
+ * @param       {InputIterator} first 第一个要插入的元素
+ * @param       {InputIterator} last 最后一个要插入的元素的下一个位置
+ * @return      {void}
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+template <typename InputIterator>
+void PQType<ElementType, Arity, Compare>::enqueueAll(InputIterator first, InputIterator last) {
+    size_type oldSize{__elements.size()};
+    // 失败时删除已追加的元素，原有的堆不受影响
+    try {
+        __elements.insert(__elements.end(), first, last);
+    } catch (const std::bad_alloc &) {
+        __elements.erase(__elements.begin() + oldSize, __elements.end());
+        throw QueueException("queue full!");
+    } catch (...) {
+        __elements.erase(__elements.begin() + oldSize, __elements.end());
+        throw;
+    }
+    if (oldSize <= __elements.size() - oldSize) {
+        __detail::__buildHeap<Arity>(__elements.begin(), __elements.end(), __compare);
+    } else {
+        for (size_type i = oldSize; i < __elements.size(); ++i) {
+            __detail::__reshapeUp<Arity>(__elements.begin(), 0, i, __compare);
+        }
+    }
+}
+
+/**
+ * @description: 按优先级从高到低依次出队至多 k 个元素，写入 out
+ * @param       {size_type} k 最多出队的元素个数
+ * @param       {OutputIterator} out 出队元素的写入位置
+ * @return      {OutputIterator} 最后一个写入的元素的下一个位置
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+template <typename OutputIterator>
+OutputIterator PQType<ElementType, Arity, Compare>::dequeueUpTo(size_type k, OutputIterator out) {
+    for (; 0 < k && !isEmpty(); --k) {
+        *out = __popTop();
+        ++out;
+    }
+    return out;
+}
+
+/**
+ * @description: 用 e 替换优先级最高的元素，等价于 dequeue 后 enqueue(e)，但只做一次向下调整
+ * @param       {ElementType} e 要插入的元素
+ * @return      {ElementType} 被替换的原优先级最高的元素
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+ElementType PQType<ElementType, Arity, Compare>::replaceTop(const ElementType &e) {
+    return __replaceTop(e);
+}
+
+/**
+ * @description: 用 e 替换优先级最高的元素，等价于 dequeue 后 enqueue(std::move(e))，但只做一次向下调整
+ * @param       {ElementType} e 要插入的元素
+ * @return      {ElementType} 被替换的原优先级最高的元素
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+ElementType PQType<ElementType, Arity, Compare>::replaceTop(ElementType &&e) {
+    return __replaceTop(std::move(e));
+}
+
+template <typename ElementType, std::size_t Arity, typename Compare>
+template <typename Element>
+ElementType PQType<ElementType, Arity, Compare>::__replaceTop(Element &&e) {
+    if (isEmpty()) {
+        throw QueueException("queue empty!");
+    }
+    // e 可能引用堆顶自身（例如 replaceTop(top())），移走堆顶之前先把它取出来
+    ElementType value(std::forward<Element>(e));
+    ElementType old{std::move(__elements.front())};
+    __elements.front() = std::move(value);
+    reshapeDown<Arity>(__elements, 0, __elements.size() - 1, __compare);
+    return old;
+}
+
+/**
+ * @description: 取出堆顶，队尾元素从堆顶的空位自底向上放回堆中。调用方保证队列不为空
+ * @return      {ElementType} 队列中优先级最高的元素
+ */
+template <typename ElementType, std::size_t Arity, typename Compare>
+ElementType PQType<ElementType, Arity, Compare>::__popTop() {
+    ElementType e(std::move(__elements.front()));
+    if (__elements.size() == 1) {
+        __elements.pop_back();
+        return e;
     }
+    ElementType last(std::move(__elements.back()));
+    __elements.pop_back();
+    __detail::__reshapeDownBottomUp<Arity>(__elements.begin(), 0, __elements.size() - 1, std::move(last), __compare);
     return e;
 }
 
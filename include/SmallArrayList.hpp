@@ -0,0 +1,629 @@
+#ifndef __SMALL_ARRAY_LIST_H__
+#define __SMALL_ARRAY_LIST_H__
+
+#include "ArrayStorage.hpp"
+#include "BoundsCheckPolicy.hpp"
+#include "GrowthPolicy.hpp"
+#include "StaticList.hpp"
+#include "format.hpp"
+#include "simd_search.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#ifdef DEBUG
+#include <cassert>
+#endif
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 19:02:17
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-21 10:26:18
+ * @FilePath     : /include/SmallArrayList.hpp
+ * @Description  : 带内联缓冲区的 List 数组实现，前 InlineCapacity 个元素直接存放在对象内部，
+ *                 超出后才通过分配器申请堆内存，适合大多数情况下元素很少、生命周期很短的集合
+ */
+template <typename ElementType, std::size_t InlineCapacity = 16, typename Allocator = std::allocator<ElementType>, typename GrowthPolicy = DefaultGrowthPolicy, typename BoundsCheck = DefaultBoundsCheck>
+class SmallArrayList final : public StaticList<SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>, BoundsCheck>,
+                             public __detail::__ArrayStorage<SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>, ElementType, Allocator> {
+public:
+    using size_type = typename StaticList<SmallArrayList, BoundsCheck>::size_type;
+    using value_type = ElementType;
+    using allocator_type = Allocator;
+    using iterator = ContiguousIterator<ElementType, SmallArrayList>;
+    using const_iterator = ContiguousIterator<const ElementType, SmallArrayList>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static_assert(InlineCapacity > 0, "InlineCapacity must be greater than 0");
+
+    explicit SmallArrayList(const Allocator &allocator = Allocator{}) noexcept;
+    SmallArrayList(const SmallArrayList &) = delete;
+    SmallArrayList(SmallArrayList &&rhs) noexcept(std::is_nothrow_move_constructible_v<ElementType>);
+    SmallArrayList &operator=(const SmallArrayList &) = delete;
+    SmallArrayList &operator=(SmallArrayList &&rhs);
+    ~SmallArrayList();
+
+    /**
+     * @description: 清除集合中的所有元素，已申请的堆内存保留
+     * @return      {void}
+     */
+    void clear();
+
+    /**
+     * @description: 获取集合中元素数量
+     * @return      {size_type} 集合中元素的数量
+     */
+    [[nodiscard]] size_type size() const;
+
+    /**
+     * @description: 检查集合是否有元素
+     * @return      {bool} 无元素返回 true，有元素返回 false
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * @description: 查找元素是否出现在集合中
+     * @param       {const ElementType &} element 需要查找的元素
+     * @return      {bool} 存在返回 true，不存在返回 false
+     */
+    [[nodiscard]] bool contains(const ElementType &element) const;
+
+    /**
+     * @description: 往集合末尾插入元素
+     * @param       {const ElementType &} element 需要插入的元素
+     * @return      {void}
+     */
+    void add(const ElementType &element);
+    void add(ElementType &&element);
+
+    /**
+     * @description: 在集合指定位置处插入元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {const ElementType &} element 要插入的元素
+     * @return      {void}
+     */
+    void add(size_type index, const ElementType &element);
+    void add(size_type index, ElementType &&element);
+
+    /**
+     * @description: 在集合指定位置处原地构造元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {Args &&...} args 元素构造参数
+     * @return      {ElementType &} 新构造的元素
+     */
+    template <typename... Args>
+    ElementType &emplace(size_type index, Args &&...args);
+
+    /**
+     * @description: 在集合末尾原地构造元素
+     * @param       {Args &&...} args 元素构造参数
+     * @return      {ElementType &} 新构造的元素
+     */
+    template <typename... Args>
+    ElementType &emplaceBack(Args &&...args);
+
+    /**
+     * @description: 将 [first, last) 中的元素依次追加到集合末尾，范围不能来自集合自身；前向迭代器最多扩容一次
+     * @param       {InputIterator} first 范围起始
+     * @param       {InputIterator} last 范围末尾
+     * @return      {void}
+     */
+    template <typename InputIterator>
+    void addAll(InputIterator first, InputIterator last);
+
+    /**
+     * @description: 获取集合指定位置处的元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {const ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] const ElementType &get(size_type index) const;
+
+    /**
+     * @description: 不做索引检查地访问集合指定位置处的元素，调用方保证 index < size()
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] ElementType &getUnchecked(size_type index) noexcept;
+    [[nodiscard]] const ElementType &getUnchecked(size_type index) const noexcept;
+
+    /**
+     * @description: 将集合指定位置处的元素设置为指定元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @param       {const ElementType &} element 要设置的元素
+     * @return      {ElementType} 设置之前的元素
+     */
+    ElementType set(size_type index, const ElementType &element);
+    ElementType set(size_type index, ElementType &&element);
+
+    /**
+     * @description: 删除集合指定位置处的元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType} 被删除的元素
+     */
+    ElementType remove(size_type index);
+
+    /**
+     * @description: 在集合中获取指定元素的位置索引
+     * @param       {const ElementType &} element 指定元素
+     * @return      {size_type} 指定元素所在的位置索引，未找到则返回 npos
+     */
+    [[nodiscard]] size_type indexOf(const ElementType &element) const;
+
+    /**
+     * @description: 将集合转换为字符串表示，可用于打印等
+     * @param       {function<std::string(const ElementType &)>} toString 将集合中元素转换为字符串的方法
+     * @return      {string} 集合的字符串表示
+     */
+    [[nodiscard]] std::string toString(std::function<std::string(const ElementType &)> toString) const;
+
+    /**
+     * @description: 获取集合当前容量，元素存放在内联缓冲区时为 InlineCapacity
+     * @return      {size_type} 集合容量
+     */
+    [[nodiscard]] size_type capacity() const;
+
+    /**
+     * @description: 判断元素当前是否存放在对象内部的缓冲区中（即尚未申请堆内存）
+     * @return      {bool} 使用内联缓冲区返回 true
+     */
+    [[nodiscard]] bool isInline() const noexcept;
+
+    [[nodiscard]] Allocator getAllocator() const;
+
+    /**
+     * @description: 预留至少 capacity 个元素的空间，不超过 InlineCapacity 时不做任何事
+     * @param       {size_type} capacity 需要的容量
+     * @return      {void}
+     */
+    void reserve(size_type capacity);
+
+    /**
+     * @description: 释放多余的堆内存，元素数量不超过 InlineCapacity 时搬回内联缓冲区
+     * @return      {void}
+     */
+    void shrinkToFit();
+
+    ElementType *data() noexcept;
+    const ElementType *data() const noexcept;
+    Span<ElementType> span() noexcept;
+    Span<const ElementType> span() const noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+    reverse_iterator rbegin() noexcept;
+    reverse_iterator rend() noexcept;
+    const_reverse_iterator rbegin() const noexcept;
+    const_reverse_iterator rend() const noexcept;
+
+private:
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename AllocatorTraits::value_type, ElementType>, "Allocator::value_type must be ElementType");
+
+    Allocator __allocator;
+    ElementType *__data;
+    size_type __size;
+    size_type __capacity;
+    alignas(ElementType) unsigned char __inlineBuffer[InlineCapacity * sizeof(ElementType)];
+
+    using __Base = StaticList<SmallArrayList, BoundsCheck>;
+    using __ListOperation = typename __Base::_Operation;
+    using __Storage = __detail::__ArrayStorage<SmallArrayList, ElementType, Allocator>;
+    friend __Storage;
+    using __Storage::_closeGap;
+    using __Storage::_destroyRange;
+    using __Storage::_emplaceAt;
+    using __Storage::_relocateTo;
+    using __Storage::_uninitializedMove;
+
+    ElementType *__inlineData() noexcept;
+    /**
+     * @description: 放弃堆内存（如果有）并回到空的内联缓冲区状态，调用前元素必须已经析构或被移走
+     * @return      {void}
+     */
+    void __resetToInline() noexcept;
+    /**
+     * @description: 将元素重定位到新容量的存储中，newCapacity 不超过 InlineCapacity 时使用内联缓冲区
+     * @return      {void}
+     */
+    void __reallocToFitNewCapacity(size_type newCapacity);
+    void __shrinkIfNecessary();
+    size_type __grownCapacity(size_type needCapacity) const;
+    /**
+     * @description: 释放旧的堆内存（如果有）并换上已经容纳全部元素的新内存 newData
+     * @return      {void}
+     */
+    void __replaceBuffer(ElementType *newData, size_type newCapacity) noexcept;
+    /**
+     * @description: 将 rhs 的元素逐个移动过来，rhs 的堆内存（如果有）保留给 rhs 自己释放
+     * @return      {void}
+     */
+    void __moveElementsFrom(SmallArrayList &rhs);
+};
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::SmallArrayList(const Allocator &allocator) noexcept :
+    __allocator{allocator}, __data{__inlineData()}, __size{0}, __capacity{InlineCapacity} {
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::SmallArrayList(SmallArrayList &&rhs) noexcept(std::is_nothrow_move_constructible_v<ElementType>) :
+    __allocator{rhs.__allocator}, __data{__inlineData()}, __size{0}, __capacity{InlineCapacity} {
+    if (rhs.isInline()) {
+        __moveElementsFrom(rhs);
+    } else {
+        // 堆内存直接接管
+        __data = rhs.__data;
+        __size = rhs.__size;
+        __capacity = rhs.__capacity;
+        rhs.__resetToInline();
+    }
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck> &SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::operator=(SmallArrayList &&rhs) {
+    if (this == &rhs) {
+        return *this;
+    }
+    clear();
+    if (!isInline()) {
+        AllocatorTraits::deallocate(__allocator, __data, __capacity);
+        __resetToInline();
+    }
+    constexpr bool propagate{AllocatorTraits::propagate_on_container_move_assignment::value};
+    if constexpr (propagate) {
+        __allocator = rhs.__allocator;
+    }
+    if (rhs.isInline() || (!propagate && __allocator != rhs.__allocator)) {
+        // 内联元素或不同分配器申请的内存无法接管，只能逐个移动
+        __moveElementsFrom(rhs);
+    } else {
+        __data = rhs.__data;
+        __size = rhs.__size;
+        __capacity = rhs.__capacity;
+        rhs.__resetToInline();
+    }
+    return *this;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::~SmallArrayList() {
+    _destroyRange(__data, __data + __size);
+    if (!isInline()) {
+        AllocatorTraits::deallocate(__allocator, __data, __capacity);
+    }
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::clear() {
+    _destroyRange(__data, __data + __size);
+    __size = 0;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::size_type SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::size() const {
+    return __size;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] bool SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::isEmpty() const {
+    return __size == 0;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] bool SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::contains(const ElementType &element) const {
+    return indexOf(element) != __Base::npos;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::add(const ElementType &element) {
+    _emplaceAt(__size, element);
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::add(ElementType &&element) {
+    _emplaceAt(__size, std::move(element));
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::add(size_type index, const ElementType &element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, size());
+    _emplaceAt(index, element);
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::add(size_type index, ElementType &&element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, size());
+    _emplaceAt(index, std::move(element));
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+template <typename... Args>
+ElementType &SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::emplace(size_type index, Args &&...args) {
+    __Base::template _checkIndex<__ListOperation::EMPLACE>(index, size());
+    return _emplaceAt(index, std::forward<Args>(args)...);
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+template <typename... Args>
+ElementType &SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::emplaceBack(Args &&...args) {
+    return _emplaceAt(__size, std::forward<Args>(args)...);
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+template <typename InputIterator>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::addAll(InputIterator first, InputIterator last) {
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>) {
+        auto count{static_cast<size_type>(std::distance(first, last))};
+        if (__size + count > __capacity) {
+            __reallocToFitNewCapacity(__grownCapacity(__size + count));
+        }
+    }
+    size_type oldSize{__size};
+    try {
+        for (; first != last; ++first) {
+            _emplaceAt(__size, *first);
+        }
+    } catch (...) {
+        _destroyRange(__data + oldSize, __data + __size);
+        __size = oldSize;
+        throw;
+    }
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] const ElementType &SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::get(size_type index) const {
+    __Base::template _checkIndex<__ListOperation::GET>(index, size());
+    return __data[index];
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] ElementType &SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::getUnchecked(size_type index) noexcept {
+#ifdef DEBUG
+    assert(index < __size);
+#endif
+    return __data[index];
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] const ElementType &SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::getUnchecked(size_type index) const noexcept {
+#ifdef DEBUG
+    assert(index < __size);
+#endif
+    return __data[index];
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ElementType SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::set(size_type index, const ElementType &element) {
+    __Base::template _checkIndex<__ListOperation::SET>(index, size());
+    // element 可能就是 __data[index]，先拷贝再替换
+    ElementType old{element};
+    std::swap(old, __data[index]);
+    return old;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ElementType SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::set(size_type index, ElementType &&element) {
+    __Base::template _checkIndex<__ListOperation::SET>(index, size());
+    ElementType old{std::move(__data[index])};
+    __data[index] = std::move(element);
+    return old;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ElementType SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::remove(size_type index) {
+    __Base::template _checkIndex<__ListOperation::REMOVE>(index, size());
+    ElementType old{std::move(__data[index])};
+    AllocatorTraits::destroy(__allocator, __data + index);
+    _closeGap(index);
+    __shrinkIfNecessary();
+    return old;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::size_type SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::indexOf(const ElementType &element) const {
+    if constexpr (simd::is_searchable_v<ElementType>) {
+        size_type index{simd::findFirst(__data, __size, element)};
+        return index != __size ? index : __Base::npos;
+    } else {
+        auto it{std::find(cbegin(), cend(), element)};
+        return it != cend() ? it - cbegin() : __Base::npos;
+    }
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] std::string SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::toString(std::function<std::string(const ElementType &)> toString) const {
+    std::string result{};
+    __Base::formatTo(std::back_inserter(result), ToStringFormatter{std::move(toString)});
+    return result;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::size_type SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::capacity() const {
+    return __capacity;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] bool SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::isInline() const noexcept {
+    return __data == reinterpret_cast<const ElementType *>(__inlineBuffer);
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+[[nodiscard]] Allocator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::getAllocator() const {
+    return __allocator;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::reserve(size_type capacity) {
+    if (capacity > __capacity) {
+        __reallocToFitNewCapacity(capacity);
+    }
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::shrinkToFit() {
+    if (!isInline() && __size < __capacity) {
+        __reallocToFitNewCapacity(__size);
+    }
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ElementType *SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::data() noexcept {
+    return __data;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+const ElementType *SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::data() const noexcept {
+    return __data;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+Span<ElementType> SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::span() noexcept {
+    return Span<ElementType>{__data, __size};
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+Span<const ElementType> SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::span() const noexcept {
+    return Span<const ElementType>{__data, __size};
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::iterator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::begin() noexcept {
+    return iterator{__data};
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::iterator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::end() noexcept {
+    return iterator{__data + __size};
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::const_iterator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::begin() const noexcept {
+    return const_iterator{__data};
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::const_iterator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::end() const noexcept {
+    return const_iterator{__data + __size};
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::const_iterator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::cbegin() const noexcept {
+    return begin();
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::const_iterator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::cend() const noexcept {
+    return end();
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::reverse_iterator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::reverse_iterator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::const_reverse_iterator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::rbegin() const noexcept {
+    return const_reverse_iterator{end()};
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::const_reverse_iterator SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::rend() const noexcept {
+    return const_reverse_iterator{begin()};
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+ElementType *SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::__inlineData() noexcept {
+    return reinterpret_cast<ElementType *>(__inlineBuffer);
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::__resetToInline() noexcept {
+    __data = __inlineData();
+    __size = 0;
+    __capacity = InlineCapacity;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::__reallocToFitNewCapacity(size_type newCapacity) {
+#ifdef DEBUG
+    assert(__size <= newCapacity);
+#endif
+    bool toInline{newCapacity <= InlineCapacity};
+    if (toInline && isInline()) {
+        return;
+    }
+    if (toInline) {
+        newCapacity = InlineCapacity;
+    }
+    ElementType *newData{toInline ? __inlineData() : AllocatorTraits::allocate(__allocator, newCapacity)};
+    try {
+        _relocateTo(newData);
+    } catch (...) {
+        if (!toInline) {
+            AllocatorTraits::deallocate(__allocator, newData, newCapacity);
+        }
+        throw;
+    }
+    __replaceBuffer(newData, newCapacity);
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::__shrinkIfNecessary() {
+    if (!isInline() && GrowthPolicy::shouldShrink(__size, __capacity)) {
+        size_type newCapacity{GrowthPolicy::shrink(__size)};
+        if (newCapacity < __capacity) {
+            __reallocToFitNewCapacity(newCapacity);
+        }
+    }
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+typename SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::size_type SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::__grownCapacity(size_type needCapacity) const {
+    return GrowthPolicy::grow(__capacity, needCapacity);
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::__replaceBuffer(ElementType *newData, size_type newCapacity) noexcept {
+    if (!isInline()) {
+        AllocatorTraits::deallocate(__allocator, __data, __capacity);
+    }
+    __data = newData;
+    __capacity = newCapacity;
+}
+
+template <typename ElementType, std::size_t InlineCapacity, typename Allocator, typename GrowthPolicy, typename BoundsCheck>
+void SmallArrayList<ElementType, InlineCapacity, Allocator, GrowthPolicy, BoundsCheck>::__moveElementsFrom(SmallArrayList &rhs) {
+    reserve(rhs.__size);
+    _uninitializedMove(rhs.__data, rhs.__data + rhs.__size, __data);
+    __size = rhs.__size;
+    rhs.clear();
+}
+
+namespace pmr {
+
+template <typename ElementType, std::size_t InlineCapacity = 16, typename GrowthPolicy = DefaultGrowthPolicy, typename BoundsCheck = DefaultBoundsCheck>
+using SmallArrayList = dsa::SmallArrayList<ElementType, InlineCapacity, std::pmr::polymorphic_allocator<ElementType>, GrowthPolicy, BoundsCheck>;
+
+} // namespace pmr
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,397 @@
+#ifndef __SOA_LIST_H__
+#define __SOA_LIST_H__
+
+#include "GrowthPolicy.hpp"
+#include "ListIndexChecker.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 10:03:51
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 10:03:51
+ * @FilePath     : /include/SoAList.hpp
+ * @Description  : 按列存储（structure of arrays）的集合，每个字段各自存放在一段连续内存中，
+ *                 只扫描一两个字段时每条缓存行都是有效数据，column<I>() 得到的 Span 可以直接交给 SIMD 查找或排序算法。
+ *                 扩容、缩容语义与 ArrayList 相同，由 GrowthPolicy 决定，所有列的容量始终一致。
+ *                 行访问返回由各字段引用组成的 std::tuple，支持结构化绑定
+ */
+template <typename GrowthPolicy, typename... Fields>
+class BasicSoAList {
+    static_assert(sizeof...(Fields) > 0, "SoAList needs at least one field");
+    static_assert((std::is_nothrow_move_constructible_v<Fields> && ...), "SoAList fields must be nothrow move constructible");
+
+public:
+    using size_type = ListIndexChecker::size_type;
+    using value_type = std::tuple<Fields...>;
+    using reference = std::tuple<Fields &...>;
+    using const_reference = std::tuple<const Fields &...>;
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+    inline static constexpr std::size_t FIELD_COUNT{sizeof...(Fields)};
+
+    explicit BasicSoAList(size_type capacity = GrowthPolicy::MIN_CAPACITY);
+    BasicSoAList(const BasicSoAList &) = delete;
+    BasicSoAList(BasicSoAList &&rhs) noexcept;
+    BasicSoAList &operator=(const BasicSoAList &) = delete;
+    BasicSoAList &operator=(BasicSoAList &&rhs) noexcept;
+    ~BasicSoAList();
+
+    /**
+     * @description: 清除集合中的所有行
+     * @return      {void}
+     */
+    void clear();
+
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] bool isEmpty() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+
+    /**
+     * @description: 在集合末尾追加一行，每个参数对应一个字段
+     * @param       {Args &&...} fields 各字段的值
+     * @return      {void}
+     */
+    template <typename... Args>
+    void add(Args &&...fields);
+
+    /**
+     * @description: 在集合指定位置处插入一行
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {Args &&...} fields 各字段的值
+     * @return      {void}
+     */
+    template <typename... Args>
+    void insert(size_type index, Args &&...fields);
+
+    /**
+     * @description: 获取集合指定位置处的行
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {const_reference} 各字段的常量引用
+     */
+    [[nodiscard]] const_reference get(size_type index) const;
+
+    /**
+     * @description: 获取集合指定位置处可修改的行，对返回的 tuple 赋值即修改集合中的字段
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {reference} 各字段的引用
+     */
+    [[nodiscard]] reference row(size_type index);
+
+    /**
+     * @description: 删除集合指定位置处的行
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {value_type} 被删除的行
+     */
+    value_type remove(size_type index);
+
+    /**
+     * @description: 删除所有满足条件的行，剩余行保持原有顺序
+     * @param       {Predicate} pred 以 const_reference 为参数的谓词
+     * @return      {size_type} 被删除的行数
+     */
+    template <typename Predicate>
+    size_type removeIf(Predicate pred);
+
+    /**
+     * @description: 获取第 I 个字段的整列视图，集合扩容、缩容或移动后视图失效
+     * @return      {Span<field_type<I>>} 列视图
+     */
+    template <std::size_t I>
+    [[nodiscard]] Span<field_type<I>> column() noexcept;
+    template <std::size_t I>
+    [[nodiscard]] Span<const field_type<I>> column() const noexcept;
+
+    void reserve(size_type capacity);
+    void shrinkToFit();
+
+private:
+    using __Columns = std::tuple<Fields *...>;
+    using __Indices = std::index_sequence_for<Fields...>;
+    using __ListOperation = ListIndexChecker::Operation;
+
+    __Columns __columns;
+    size_type __size;
+    size_type __capacity;
+
+    template <std::size_t... I>
+    static __Columns __allocateColumns(size_type capacity, std::index_sequence<I...>);
+    template <std::size_t... I>
+    static void __deallocateColumns(__Columns &columns, size_type capacity, std::index_sequence<I...>) noexcept;
+    /**
+     * @description: 将 [from, to) 行的所有字段重定位到 dest 列中从 destIndex 开始的位置，结束后原位置视为未初始化
+     * @return      {void}
+     */
+    template <std::size_t... I>
+    static void __relocateRows(__Columns &src, size_type from, size_type to, __Columns &dest, size_type destIndex, std::index_sequence<I...>) noexcept;
+    template <typename T>
+    static void __relocate(T *first, T *last, T *dest) noexcept;
+    template <std::size_t... I>
+    void __destroyRows(size_type from, size_type to, std::index_sequence<I...>) noexcept;
+    template <std::size_t... I>
+    const_reference __getRow(size_type index, std::index_sequence<I...>) const noexcept;
+    template <std::size_t... I>
+    reference __getRow(size_type index, std::index_sequence<I...>) noexcept;
+    template <std::size_t... I>
+    value_type __moveRow(size_type index, std::index_sequence<I...>) noexcept;
+    template <std::size_t... I, typename... Args>
+    void __constructRow(size_type index, std::index_sequence<I...>, Args &&...fields);
+    void __reallocToFitNewCapacity(size_type newCapacity);
+    void __shrinkIfNecessary();
+};
+
+template <typename... Fields>
+using SoAList = BasicSoAList<DefaultGrowthPolicy, Fields...>;
+
+template <typename GrowthPolicy, typename... Fields>
+BasicSoAList<GrowthPolicy, Fields...>::BasicSoAList(size_type capacity) :
+    __columns{__allocateColumns(std::max(capacity, GrowthPolicy::MIN_CAPACITY), __Indices{})}, __size{0}, __capacity{std::max(capacity, GrowthPolicy::MIN_CAPACITY)} {
+}
+
+template <typename GrowthPolicy, typename... Fields>
+BasicSoAList<GrowthPolicy, Fields...>::BasicSoAList(BasicSoAList &&rhs) noexcept :
+    __columns{std::exchange(rhs.__columns, __Columns{})}, __size{std::exchange(rhs.__size, 0)}, __capacity{std::exchange(rhs.__capacity, 0)} {
+}
+
+template <typename GrowthPolicy, typename... Fields>
+BasicSoAList<GrowthPolicy, Fields...> &BasicSoAList<GrowthPolicy, Fields...>::operator=(BasicSoAList &&rhs) noexcept {
+    if (this != &rhs) {
+        clear();
+        __deallocateColumns(__columns, __capacity, __Indices{});
+        __columns = std::exchange(rhs.__columns, __Columns{});
+        __size = std::exchange(rhs.__size, 0);
+        __capacity = std::exchange(rhs.__capacity, 0);
+    }
+    return *this;
+}
+
+template <typename GrowthPolicy, typename... Fields>
+BasicSoAList<GrowthPolicy, Fields...>::~BasicSoAList() {
+    clear();
+    __deallocateColumns(__columns, __capacity, __Indices{});
+}
+
+template <typename GrowthPolicy, typename... Fields>
+void BasicSoAList<GrowthPolicy, Fields...>::clear() {
+    __destroyRows(0, __size, __Indices{});
+    __size = 0;
+}
+
+template <typename GrowthPolicy, typename... Fields>
+[[nodiscard]] typename BasicSoAList<GrowthPolicy, Fields...>::size_type BasicSoAList<GrowthPolicy, Fields...>::size() const noexcept {
+    return __size;
+}
+
+template <typename GrowthPolicy, typename... Fields>
+[[nodiscard]] bool BasicSoAList<GrowthPolicy, Fields...>::isEmpty() const noexcept {
+    return __size == 0;
+}
+
+template <typename GrowthPolicy, typename... Fields>
+[[nodiscard]] typename BasicSoAList<GrowthPolicy, Fields...>::size_type BasicSoAList<GrowthPolicy, Fields...>::capacity() const noexcept {
+    return __capacity;
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <typename... Args>
+void BasicSoAList<GrowthPolicy, Fields...>::add(Args &&...fields) {
+    insert(__size, std::forward<Args>(fields)...);
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <typename... Args>
+void BasicSoAList<GrowthPolicy, Fields...>::insert(size_type index, Args &&...fields) {
+    static_assert(sizeof...(Args) == sizeof...(Fields), "one value is needed for each field");
+    ListIndexChecker::checkIndex<__ListOperation::ADD_BY_INDEX>(index, __size);
+    // 参数可能引用集合内部的字段，移动任何元素前先构造出整行
+    value_type value{std::forward<Args>(fields)...};
+    if (__size == __capacity) {
+        __reallocToFitNewCapacity(GrowthPolicy::grow(__capacity, __size + 1));
+    }
+    // 字段的移动构造不抛异常，先把 index 之后的行整体后移一位
+    __relocateRows(__columns, index, __size, __columns, index + 1, __Indices{});
+    std::apply([this, index](auto &&...values) { __constructRow(index, __Indices{}, std::move(values)...); }, std::move(value));
+    ++__size;
+}
+
+template <typename GrowthPolicy, typename... Fields>
+[[nodiscard]] typename BasicSoAList<GrowthPolicy, Fields...>::const_reference BasicSoAList<GrowthPolicy, Fields...>::get(size_type index) const {
+    ListIndexChecker::checkIndex<__ListOperation::GET>(index, __size);
+    return __getRow(index, __Indices{});
+}
+
+template <typename GrowthPolicy, typename... Fields>
+[[nodiscard]] typename BasicSoAList<GrowthPolicy, Fields...>::reference BasicSoAList<GrowthPolicy, Fields...>::row(size_type index) {
+    ListIndexChecker::checkIndex<__ListOperation::GET>(index, __size);
+    return __getRow(index, __Indices{});
+}
+
+template <typename GrowthPolicy, typename... Fields>
+typename BasicSoAList<GrowthPolicy, Fields...>::value_type BasicSoAList<GrowthPolicy, Fields...>::remove(size_type index) {
+    ListIndexChecker::checkIndex<__ListOperation::REMOVE>(index, __size);
+    value_type old{__moveRow(index, __Indices{})};
+    __destroyRows(index, index + 1, __Indices{});
+    __relocateRows(__columns, index + 1, __size, __columns, index, __Indices{});
+    --__size;
+    __shrinkIfNecessary();
+    return old;
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <typename Predicate>
+typename BasicSoAList<GrowthPolicy, Fields...>::size_type BasicSoAList<GrowthPolicy, Fields...>::removeIf(Predicate pred) {
+    size_type kept{0};
+    for (size_type i = 0; i < __size; ++i) {
+        if (pred(std::as_const(*this).__getRow(i, __Indices{}))) {
+            continue;
+        }
+        if (kept != i) {
+            __getRow(kept, __Indices{}) = __moveRow(i, __Indices{});
+        }
+        ++kept;
+    }
+    size_type removed{__size - kept};
+    __destroyRows(kept, __size, __Indices{});
+    __size = kept;
+    __shrinkIfNecessary();
+    return removed;
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <std::size_t I>
+[[nodiscard]] Span<typename BasicSoAList<GrowthPolicy, Fields...>::template field_type<I>> BasicSoAList<GrowthPolicy, Fields...>::column() noexcept {
+    return Span<field_type<I>>{std::get<I>(__columns), __size};
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <std::size_t I>
+[[nodiscard]] Span<const typename BasicSoAList<GrowthPolicy, Fields...>::template field_type<I>> BasicSoAList<GrowthPolicy, Fields...>::column() const noexcept {
+    return Span<const field_type<I>>{std::get<I>(__columns), __size};
+}
+
+template <typename GrowthPolicy, typename... Fields>
+void BasicSoAList<GrowthPolicy, Fields...>::reserve(size_type capacity) {
+    if (capacity > __capacity) {
+        __reallocToFitNewCapacity(capacity);
+    }
+}
+
+template <typename GrowthPolicy, typename... Fields>
+void BasicSoAList<GrowthPolicy, Fields...>::shrinkToFit() {
+    size_type newCapacity{std::max(__size, GrowthPolicy::MIN_CAPACITY)};
+    if (newCapacity < __capacity) {
+        __reallocToFitNewCapacity(newCapacity);
+    }
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <std::size_t... I>
+typename BasicSoAList<GrowthPolicy, Fields...>::__Columns BasicSoAList<GrowthPolicy, Fields...>::__allocateColumns(size_type capacity, std::index_sequence<I...>) {
+    __Columns columns{};
+    try {
+        ((std::get<I>(columns) = std::allocator<Fields>{}.allocate(capacity)), ...);
+    } catch (...) {
+        __deallocateColumns(columns, capacity, std::index_sequence<I...>{});
+        throw;
+    }
+    return columns;
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <std::size_t... I>
+void BasicSoAList<GrowthPolicy, Fields...>::__deallocateColumns(__Columns &columns, size_type capacity, std::index_sequence<I...>) noexcept {
+    ((std::get<I>(columns) != nullptr ? std::allocator<Fields>{}.deallocate(std::get<I>(columns), capacity) : void()), ...);
+    columns = __Columns{};
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <std::size_t... I>
+void BasicSoAList<GrowthPolicy, Fields...>::__relocateRows(__Columns &src, size_type from, size_type to, __Columns &dest, size_type destIndex, std::index_sequence<I...>) noexcept {
+    (__relocate(std::get<I>(src) + from, std::get<I>(src) + to, std::get<I>(dest) + destIndex), ...);
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <typename T>
+void BasicSoAList<GrowthPolicy, Fields...>::__relocate(T *first, T *last, T *dest) noexcept {
+    if (first == last || first == dest) {
+        return;
+    }
+    if constexpr (is_trivially_relocatable_v<T>) {
+        std::memmove(static_cast<void *>(dest), static_cast<const void *>(first), (last - first) * sizeof(T));
+    } else if (dest < first) {
+        for (; first != last; ++first, ++dest) {
+            ::new (static_cast<void *>(dest)) T(std::move(*first));
+            first->~T();
+        }
+    } else {
+        // 区间可能重叠且向后移动，从尾部开始
+        T *destLast{dest + (last - first)};
+        while (last != first) {
+            --last;
+            --destLast;
+            ::new (static_cast<void *>(destLast)) T(std::move(*last));
+            last->~T();
+        }
+    }
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <std::size_t... I>
+void BasicSoAList<GrowthPolicy, Fields...>::__destroyRows(size_type from, size_type to, std::index_sequence<I...>) noexcept {
+    (std::destroy(std::get<I>(__columns) + from, std::get<I>(__columns) + to), ...);
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <std::size_t... I>
+typename BasicSoAList<GrowthPolicy, Fields...>::const_reference BasicSoAList<GrowthPolicy, Fields...>::__getRow(size_type index, std::index_sequence<I...>) const noexcept {
+    return const_reference{std::get<I>(__columns)[index]...};
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <std::size_t... I>
+typename BasicSoAList<GrowthPolicy, Fields...>::reference BasicSoAList<GrowthPolicy, Fields...>::__getRow(size_type index, std::index_sequence<I...>) noexcept {
+    return reference{std::get<I>(__columns)[index]...};
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <std::size_t... I>
+typename BasicSoAList<GrowthPolicy, Fields...>::value_type BasicSoAList<GrowthPolicy, Fields...>::__moveRow(size_type index, std::index_sequence<I...>) noexcept {
+    return value_type{std::move(std::get<I>(__columns)[index])...};
+}
+
+template <typename GrowthPolicy, typename... Fields>
+template <std::size_t... I, typename... Args>
+void BasicSoAList<GrowthPolicy, Fields...>::__constructRow(size_type index, std::index_sequence<I...>, Args &&...fields) {
+    (::new (static_cast<void *>(std::get<I>(__columns) + index)) Fields(std::forward<Args>(fields)), ...);
+}
+
+template <typename GrowthPolicy, typename... Fields>
+void BasicSoAList<GrowthPolicy, Fields...>::__reallocToFitNewCapacity(size_type newCapacity) {
+    __Columns newColumns{__allocateColumns(newCapacity, __Indices{})};
+    __relocateRows(__columns, 0, __size, newColumns, 0, __Indices{});
+    __deallocateColumns(__columns, __capacity, __Indices{});
+    __columns = newColumns;
+    __capacity = newCapacity;
+}
+
+template <typename GrowthPolicy, typename... Fields>
+void BasicSoAList<GrowthPolicy, Fields...>::__shrinkIfNecessary() {
+    if (GrowthPolicy::shouldShrink(__size, __capacity)) {
+        size_type newCapacity{GrowthPolicy::shrink(__size)};
+        if (newCapacity < __capacity) {
+            __reallocToFitNewCapacity(newCapacity);
+        }
+    }
+}
+
+} // namespace dsa
+
+#endif
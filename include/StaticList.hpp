@@ -0,0 +1,218 @@
+#ifndef __STATIC_LIST_H__
+#define __STATIC_LIST_H__
+
+#include "BoundsCheckPolicy.hpp"
+#include "ListIndexChecker.hpp"
+#include "format.hpp"
+#include <functional>
+#include <iterator>
+#include <ostream>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 16:48:03
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 23:14:26
+ * @FilePath     : /include/StaticList.hpp
+ * @Description  : List 的静态分派（CRTP）基类，与 AbstractList 的索引检查语义一致，但没有任何虚函数。
+ *                 模板算法接受 StaticList<Derived> & 即可在编译期确定具体实现，get/size 等调用可以被内联；
+ *                 需要运行时多态时再用 ListAdapter 包装成 List 接口。
+ *                 BoundsCheck 为索引检查策略，派生类通过 _checkIndex/_checkRange 使用；Derived 需要提供 getUnchecked 以支持 operator[]
+ */
+template <typename Derived, typename BoundsCheck = DefaultBoundsCheck>
+class StaticList {
+public:
+    using size_type = ListIndexChecker::size_type;
+    inline static constexpr size_type npos{std::numeric_limits<size_type>::max()};
+
+    /**
+     * @description: 清除集合中的所有元素
+     * @return      {void}
+     */
+    void clear() {
+        _derived().clear();
+    }
+
+    /**
+     * @description: 获取集合中元素数量
+     * @return      {size_type} 集合中元素的数量
+     */
+    [[nodiscard]] size_type size() const {
+        return _derived().size();
+    }
+
+    /**
+     * @description: 检查集合是否有元素
+     * @return      {bool} 无元素返回 true，有元素返回 false
+     */
+    [[nodiscard]] bool isEmpty() const {
+        return _derived().size() == 0;
+    }
+
+    /**
+     * @description: 查找元素是否出现在集合中
+     * @param       {const ElementType &} element 需要查找的元素
+     * @return      {bool} 存在返回 true，不存在返回 false
+     */
+    template <typename ElementType>
+    [[nodiscard]] bool contains(const ElementType &element) const {
+        return _derived().indexOf(element) != npos;
+    }
+
+    /**
+     * @description: 往集合末尾插入元素
+     * @param       {ElementType &&} element 需要插入的元素
+     * @return      {void}
+     */
+    template <typename ElementType>
+    void add(ElementType &&element) {
+        _derived().add(std::forward<ElementType>(element));
+    }
+
+    /**
+     * @description: 在集合指定位置处插入元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {ElementType &&} element 要插入的元素
+     * @return      {void}
+     */
+    template <typename ElementType>
+    void add(size_type index, ElementType &&element) {
+        _derived().add(index, std::forward<ElementType>(element));
+    }
+
+    /**
+     * @description: 获取集合指定位置处的元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {const ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] decltype(auto) get(size_type index) const {
+        return _derived().get(index);
+    }
+
+    /**
+     * @description: 不做索引检查地访问集合指定位置处的元素，调用方保证 index < size()
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] decltype(auto) getUnchecked(size_type index) noexcept {
+        return _derived().getUnchecked(index);
+    }
+
+    [[nodiscard]] decltype(auto) getUnchecked(size_type index) const noexcept {
+        return _derived().getUnchecked(index);
+    }
+
+    decltype(auto) operator[](size_type index) noexcept {
+        return _derived().getUnchecked(index);
+    }
+
+    decltype(auto) operator[](size_type index) const noexcept {
+        return _derived().getUnchecked(index);
+    }
+
+    /**
+     * @description: 将集合指定位置处的元素设置为指定元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @param       {ElementType &&} element 要设置的元素
+     * @return      {ElementType} 设置之前的元素
+     */
+    template <typename ElementType>
+    decltype(auto) set(size_type index, ElementType &&element) {
+        return _derived().set(index, std::forward<ElementType>(element));
+    }
+
+    /**
+     * @description: 删除集合指定位置处的元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType} 被删除的元素
+     */
+    decltype(auto) remove(size_type index) {
+        return _derived().remove(index);
+    }
+
+    /**
+     * @description: 在集合中获取指定元素的位置索引
+     * @param       {const ElementType &} element 指定元素
+     * @return      {size_type} 指定元素所在的位置索引，未找到则返回 npos
+     */
+    template <typename ElementType>
+    [[nodiscard]] size_type indexOf(const ElementType &element) const {
+        return _derived().indexOf(element);
+    }
+
+    /**
+     * @description: 将集合转换为字符串表示，可用于打印等
+     * @param       {ToString} toString 将集合中元素转换为字符串的方法
+     * @return      {string} 集合的字符串表示
+     */
+    template <typename ToString>
+    [[nodiscard]] std::string toString(ToString &&toString) const {
+        return _derived().toString(std::forward<ToString>(toString));
+    }
+
+    /**
+     * @description: 将集合格式化为 "[e1, e2, ...]" 写入输出迭代器，不为元素创建临时字符串
+     * @param       {OutputIt} out 字符输出迭代器
+     * @param       {Formatter} formatter 元素格式化方法，调用方式为 out = formatter(out, element)
+     * @return      {OutputIt} 写入后的输出迭代器
+     */
+    template <typename OutputIt, typename Formatter = DefaultFormatter>
+    OutputIt formatTo(OutputIt out, Formatter formatter = Formatter{}) const {
+        return formatIndexed(_derived(), _derived().size(), out, std::move(formatter));
+    }
+
+    /**
+     * @description: 将集合格式化后直接写入输出流
+     * @param       {ostream &} os 输出流
+     * @param       {Formatter} formatter 元素格式化方法
+     * @return      {ostream &} 输出流
+     */
+    template <typename Formatter = DefaultFormatter>
+    std::ostream &writeTo(std::ostream &os, Formatter formatter = Formatter{}) const {
+        // 派生类可以提供更高效的 formatTo（例如按迭代器遍历的链表），这里同样静态分派到派生类
+        _derived().formatTo(std::ostreambuf_iterator<char>{os}, std::move(formatter));
+        return os;
+    }
+
+protected:
+    using _Operation = ListIndexChecker::Operation;
+
+    StaticList() = default;
+    StaticList(const StaticList &) = default;
+    StaticList(StaticList &&) = default;
+    StaticList &operator=(const StaticList &) = default;
+    StaticList &operator=(StaticList &&) = default;
+    // 非虚析构，禁止通过基类指针删除
+    ~StaticList() = default;
+
+    template <_Operation Operation>
+    static void _checkIndex(size_type index, size_type size) {
+        BoundsCheck::template checkIndex<Operation>(index, size);
+    }
+
+    /**
+     * @description: 检查区间 [from, to) 是否合法，要求 from <= to <= size
+     * @return      {void}
+     */
+    template <_Operation Operation>
+    static void _checkRange(size_type from, size_type to, size_type size) {
+        BoundsCheck::template checkRange<Operation>(from, to, size);
+    }
+
+    Derived &_derived() noexcept {
+        return static_cast<Derived &>(*this);
+    }
+
+    const Derived &_derived() const noexcept {
+        return static_cast<const Derived &>(*this);
+    }
+};
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,600 @@
+#ifndef __TIERED_LIST_H__
+#define __TIERED_LIST_H__
+
+#include "StaticList.hpp"
+#include "format.hpp"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef DEBUG
+#include <cassert>
+#endif
+
+namespace dsa {
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 20:31:55
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-21 11:20:07
+ * @FilePath     : /include/TieredList.hpp
+ * @Description  : List 的分层向量（tiered vector）实现。元素按顺序存放在若干容量为 B 的环形块中，除最后一块外都是满的，
+ *                 因此 get(index) 只需要两次移位和一次取模即可定位，仍然是 O(1)；
+ *                 中间插入/删除只在目标块内移动元素，其余块各自在头尾进出一个元素，代价为 O(B + n / B)。
+ *                 B 始终为 2 的幂并随 size 调整，使 B 保持在 √n 附近，插入/删除为 O(√n)
+ */
+template <typename ElementType, typename Allocator = std::allocator<ElementType>>
+class TieredList final : public StaticList<TieredList<ElementType, Allocator>> {
+public:
+    using size_type = typename StaticList<TieredList>::size_type;
+    using value_type = ElementType;
+    using allocator_type = Allocator;
+
+    explicit TieredList(const Allocator &allocator = Allocator{});
+    TieredList(const TieredList &) = delete;
+    TieredList(TieredList &&rhs) noexcept;
+    TieredList &operator=(const TieredList &) = delete;
+    TieredList &operator=(TieredList &&rhs) noexcept;
+    ~TieredList();
+
+    /**
+     * @description: 清除集合中的所有元素
+     * @return      {void}
+     */
+    void clear();
+
+    /**
+     * @description: 获取集合中元素数量
+     * @return      {size_type} 集合中元素的数量
+     */
+    [[nodiscard]] size_type size() const;
+
+    /**
+     * @description: 检查集合是否有元素
+     * @return      {bool} 无元素返回 true，有元素返回 false
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * @description: 查找元素是否出现在集合中
+     * @param       {const ElementType &} element 需要查找的元素
+     * @return      {bool} 存在返回 true，不存在返回 false
+     */
+    [[nodiscard]] bool contains(const ElementType &element) const;
+
+    /**
+     * @description: 往集合末尾插入元素，均摊 O(1)
+     * @param       {const ElementType &} element 需要插入的元素
+     * @return      {void}
+     */
+    void add(const ElementType &element);
+    void add(ElementType &&element);
+
+    /**
+     * @description: 在集合指定位置处插入元素，O(√n)
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {const ElementType &} element 要插入的元素
+     * @return      {void}
+     */
+    void add(size_type index, const ElementType &element);
+    void add(size_type index, ElementType &&element);
+
+    /**
+     * @description: 在集合指定位置处原地构造元素，O(√n)
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size()]
+     * @param       {Args &&...} args 元素构造参数
+     * @return      {ElementType &} 新构造的元素
+     */
+    template <typename... Args>
+    ElementType &emplace(size_type index, Args &&...args);
+
+    /**
+     * @description: 获取集合指定位置处的元素，O(1)
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {const ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] const ElementType &get(size_type index) const;
+
+    /**
+     * @description: 不做索引检查地访问集合指定位置处的元素，调用方保证 index < size()
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType &} 指定位置处的元素
+     */
+    [[nodiscard]] ElementType &getUnchecked(size_type index) noexcept;
+    [[nodiscard]] const ElementType &getUnchecked(size_type index) const noexcept;
+
+    /**
+     * @description: 将集合指定位置处的元素设置为指定元素
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @param       {const ElementType &} element 要设置的元素
+     * @return      {ElementType} 设置之前的元素
+     */
+    ElementType set(size_type index, const ElementType &element);
+    ElementType set(size_type index, ElementType &&element);
+
+    /**
+     * @description: 删除集合指定位置处的元素，O(√n)
+     * @param       {size_type} index 指定位置索引，取值范围 [0, size() - 1]
+     * @return      {ElementType} 被删除的元素
+     */
+    ElementType remove(size_type index);
+
+    /**
+     * @description: 在集合中获取指定元素的位置索引
+     * @param       {const ElementType &} element 指定元素
+     * @return      {size_type} 指定元素所在的位置索引，未找到则返回 npos
+     */
+    [[nodiscard]] size_type indexOf(const ElementType &element) const;
+
+    /**
+     * @description: 按顺序访问集合中的所有元素
+     * @param       {Function} function 对每个元素调用的方法
+     * @return      {void}
+     */
+    template <typename Function>
+    void forEach(Function function) const;
+
+    /**
+     * @description: 将集合转换为字符串表示，可用于打印等
+     * @param       {function<std::string(const ElementType &)>} toString 将集合中元素转换为字符串的方法
+     * @return      {string} 集合的字符串表示
+     */
+    [[nodiscard]] std::string toString(std::function<std::string(const ElementType &)> toString) const;
+
+    /**
+     * @description: 获取当前每个块的容量 B
+     * @return      {size_type} 块容量
+     */
+    [[nodiscard]] size_type blockCapacity() const noexcept;
+
+private:
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename AllocatorTraits::value_type, ElementType>, "Allocator::value_type must be ElementType");
+
+    // 环形块：逻辑上第 j 个元素位于 data[(head + j) & mask]
+    struct __Block {
+        ElementType *data;
+        size_type head;
+        size_type count;
+    };
+    using __BlockAllocator = typename AllocatorTraits::template rebind_alloc<__Block>;
+
+    // 块容量最小为 2^4
+    inline static constexpr size_type __MIN_BLOCK_SHIFT{4};
+
+    Allocator __allocator;
+    std::vector<__Block, __BlockAllocator> __blocks;
+    size_type __size;
+    size_type __blockShift;
+
+    using __Base = StaticList<TieredList>;
+    using __ListOperation = typename __Base::_Operation;
+
+    size_type __blockMask() const noexcept;
+    ElementType *__slot(const __Block &block, size_type offset) const noexcept;
+    ElementType &__at(size_type index) const noexcept;
+
+    __Block __allocateBlock();
+    /**
+     * @description: 在末尾追加一个空块，先为它在 __blocks 中预留位置再分配，push_back 不会抛出异常，新分配的块不会泄漏
+     * @return      {void}
+     */
+    void __appendBlock();
+    void __deallocateBlock(__Block &block);
+    void __destroyBlock(__Block &block);
+    void __pushBack(__Block &block, ElementType &&element);
+    void __pushFront(__Block &block, ElementType &&element);
+    ElementType __popBack(__Block &block);
+    ElementType __popFront(__Block &block);
+    /**
+     * @description: 在未满的块内第 offset 个位置插入元素，朝元素较少的一侧移动
+     * @return      {void}
+     */
+    void __insertIntoBlock(__Block &block, size_type offset, ElementType &&element);
+    /**
+     * @description: 删除块内第 offset 个元素，朝元素较少的一侧移动
+     * @return      {ElementType} 被删除的元素
+     */
+    ElementType __eraseFromBlock(__Block &block, size_type offset);
+    template <typename... Args>
+    ElementType &__emplaceAt(size_type index, Args &&...args);
+    /**
+     * @description: size 超出 [B^2 / 4, 4B^2] 范围时以新的块容量重建，使 B 保持在 √n 附近；新块分配失败时保持原有块容量
+     * @return      {void}
+     */
+    void __rebalanceIfNecessary();
+    /**
+     * @description: 以新的块容量重建，先分配全部新块，分配失败时抛出 std::bad_alloc 且集合保持不变
+     * @return      {void}
+     */
+    void __rebuild(size_type newBlockShift);
+    void __releaseBlocks();
+};
+
+template <typename ElementType, typename Allocator>
+TieredList<ElementType, Allocator>::TieredList(const Allocator &allocator) :
+    __allocator{allocator}, __blocks(__BlockAllocator{allocator}), __size{0}, __blockShift{__MIN_BLOCK_SHIFT} {
+}
+
+template <typename ElementType, typename Allocator>
+TieredList<ElementType, Allocator>::TieredList(TieredList &&rhs) noexcept :
+    __allocator{rhs.__allocator}, __blocks{std::move(rhs.__blocks)}, __size{std::exchange(rhs.__size, 0)}, __blockShift{std::exchange(rhs.__blockShift, __MIN_BLOCK_SHIFT)} {
+    rhs.__blocks.clear();
+}
+
+template <typename ElementType, typename Allocator>
+TieredList<ElementType, Allocator> &TieredList<ElementType, Allocator>::operator=(TieredList &&rhs) noexcept {
+    static_assert(AllocatorTraits::is_always_equal::value || AllocatorTraits::propagate_on_container_move_assignment::value,
+                  "move assignment requires allocators that are always equal or propagate on move assignment");
+    if (this != &rhs) {
+        __releaseBlocks();
+        __allocator = rhs.__allocator;
+        __blocks = std::move(rhs.__blocks);
+        rhs.__blocks.clear();
+        __size = std::exchange(rhs.__size, 0);
+        __blockShift = std::exchange(rhs.__blockShift, __MIN_BLOCK_SHIFT);
+    }
+    return *this;
+}
+
+template <typename ElementType, typename Allocator>
+TieredList<ElementType, Allocator>::~TieredList() {
+    __releaseBlocks();
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::clear() {
+    __releaseBlocks();
+    __size = 0;
+    __blockShift = __MIN_BLOCK_SHIFT;
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] typename TieredList<ElementType, Allocator>::size_type TieredList<ElementType, Allocator>::size() const {
+    return __size;
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] bool TieredList<ElementType, Allocator>::isEmpty() const {
+    return __size == 0;
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] bool TieredList<ElementType, Allocator>::contains(const ElementType &element) const {
+    return indexOf(element) != __Base::npos;
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::add(const ElementType &element) {
+    __emplaceAt(__size, element);
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::add(ElementType &&element) {
+    __emplaceAt(__size, std::move(element));
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::add(size_type index, const ElementType &element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, size());
+    __emplaceAt(index, element);
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::add(size_type index, ElementType &&element) {
+    __Base::template _checkIndex<__ListOperation::ADD_BY_INDEX>(index, size());
+    __emplaceAt(index, std::move(element));
+}
+
+template <typename ElementType, typename Allocator>
+template <typename... Args>
+ElementType &TieredList<ElementType, Allocator>::emplace(size_type index, Args &&...args) {
+    __Base::template _checkIndex<__ListOperation::EMPLACE>(index, size());
+    return __emplaceAt(index, std::forward<Args>(args)...);
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] const ElementType &TieredList<ElementType, Allocator>::get(size_type index) const {
+    __Base::template _checkIndex<__ListOperation::GET>(index, size());
+    return __at(index);
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] ElementType &TieredList<ElementType, Allocator>::getUnchecked(size_type index) noexcept {
+#ifdef DEBUG
+    assert(index < __size);
+#endif
+    return __at(index);
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] const ElementType &TieredList<ElementType, Allocator>::getUnchecked(size_type index) const noexcept {
+#ifdef DEBUG
+    assert(index < __size);
+#endif
+    return __at(index);
+}
+
+template <typename ElementType, typename Allocator>
+ElementType TieredList<ElementType, Allocator>::set(size_type index, const ElementType &element) {
+    __Base::template _checkIndex<__ListOperation::SET>(index, size());
+    // element 可能就是被替换的元素，先拷贝再替换
+    ElementType old{element};
+    std::swap(old, __at(index));
+    return old;
+}
+
+template <typename ElementType, typename Allocator>
+ElementType TieredList<ElementType, Allocator>::set(size_type index, ElementType &&element) {
+    __Base::template _checkIndex<__ListOperation::SET>(index, size());
+    ElementType &target{__at(index)};
+    ElementType old{std::move(target)};
+    target = std::move(element);
+    return old;
+}
+
+template <typename ElementType, typename Allocator>
+ElementType TieredList<ElementType, Allocator>::remove(size_type index) {
+    __Base::template _checkIndex<__ListOperation::REMOVE>(index, size());
+    size_type blockIndex{index >> __blockShift};
+    ElementType old{__eraseFromBlock(__blocks[blockIndex], index & __blockMask())};
+    // 后面每一块把头部元素补到前一块的尾部，保持除最后一块外都是满的
+    for (size_type i{blockIndex + 1}; i < __blocks.size(); ++i) {
+        __pushBack(__blocks[i - 1], __popFront(__blocks[i]));
+    }
+    if (__blocks.back().count == 0) {
+        __deallocateBlock(__blocks.back());
+        __blocks.pop_back();
+    }
+    --__size;
+    __rebalanceIfNecessary();
+    return old;
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] typename TieredList<ElementType, Allocator>::size_type TieredList<ElementType, Allocator>::indexOf(const ElementType &element) const {
+    size_type index{0};
+    for (const __Block &block : __blocks) {
+        for (size_type offset{0}; offset < block.count; ++offset, ++index) {
+            if (*__slot(block, offset) == element) {
+                return index;
+            }
+        }
+    }
+    return __Base::npos;
+}
+
+template <typename ElementType, typename Allocator>
+template <typename Function>
+void TieredList<ElementType, Allocator>::forEach(Function function) const {
+    for (const __Block &block : __blocks) {
+        for (size_type offset{0}; offset < block.count; ++offset) {
+            function(static_cast<const ElementType &>(*__slot(block, offset)));
+        }
+    }
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] std::string TieredList<ElementType, Allocator>::toString(std::function<std::string(const ElementType &)> toString) const {
+    std::string result{};
+    __Base::formatTo(std::back_inserter(result), ToStringFormatter{std::move(toString)});
+    return result;
+}
+
+template <typename ElementType, typename Allocator>
+[[nodiscard]] typename TieredList<ElementType, Allocator>::size_type TieredList<ElementType, Allocator>::blockCapacity() const noexcept {
+    return size_type{1} << __blockShift;
+}
+
+template <typename ElementType, typename Allocator>
+typename TieredList<ElementType, Allocator>::size_type TieredList<ElementType, Allocator>::__blockMask() const noexcept {
+    return blockCapacity() - 1;
+}
+
+template <typename ElementType, typename Allocator>
+ElementType *TieredList<ElementType, Allocator>::__slot(const __Block &block, size_type offset) const noexcept {
+    return block.data + ((block.head + offset) & __blockMask());
+}
+
+template <typename ElementType, typename Allocator>
+ElementType &TieredList<ElementType, Allocator>::__at(size_type index) const noexcept {
+    return *__slot(__blocks[index >> __blockShift], index & __blockMask());
+}
+
+template <typename ElementType, typename Allocator>
+typename TieredList<ElementType, Allocator>::__Block TieredList<ElementType, Allocator>::__allocateBlock() {
+    return __Block{AllocatorTraits::allocate(__allocator, blockCapacity()), 0, 0};
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::__appendBlock() {
+    if (__blocks.size() == __blocks.capacity()) {
+        __blocks.reserve(std::max<size_type>(2 * __blocks.size(), 1));
+    }
+    __blocks.push_back(__allocateBlock());
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::__deallocateBlock(__Block &block) {
+    AllocatorTraits::deallocate(__allocator, block.data, blockCapacity());
+    block.data = nullptr;
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::__destroyBlock(__Block &block) {
+    for (size_type offset{0}; offset < block.count; ++offset) {
+        AllocatorTraits::destroy(__allocator, __slot(block, offset));
+    }
+    block.count = 0;
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::__pushBack(__Block &block, ElementType &&element) {
+    AllocatorTraits::construct(__allocator, __slot(block, block.count), std::move(element));
+    ++block.count;
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::__pushFront(__Block &block, ElementType &&element) {
+    size_type newHead{(block.head - 1) & __blockMask()};
+    AllocatorTraits::construct(__allocator, block.data + newHead, std::move(element));
+    block.head = newHead;
+    ++block.count;
+}
+
+template <typename ElementType, typename Allocator>
+ElementType TieredList<ElementType, Allocator>::__popBack(__Block &block) {
+    ElementType *last{__slot(block, block.count - 1)};
+    ElementType element{std::move(*last)};
+    AllocatorTraits::destroy(__allocator, last);
+    --block.count;
+    return element;
+}
+
+template <typename ElementType, typename Allocator>
+ElementType TieredList<ElementType, Allocator>::__popFront(__Block &block) {
+    ElementType *first{__slot(block, 0)};
+    ElementType element{std::move(*first)};
+    AllocatorTraits::destroy(__allocator, first);
+    block.head = (block.head + 1) & __blockMask();
+    --block.count;
+    return element;
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::__insertIntoBlock(__Block &block, size_type offset, ElementType &&element) {
+#ifdef DEBUG
+    assert(offset <= block.count && block.count < blockCapacity());
+#endif
+    if (offset == block.count) {
+        __pushBack(block, std::move(element));
+    } else if (offset == 0) {
+        __pushFront(block, std::move(element));
+    } else if (offset < block.count / 2) {
+        // 前半部分整体前移一位
+        __pushFront(block, std::move(*__slot(block, 0)));
+        for (size_type i{1}; i < offset; ++i) {
+            *__slot(block, i) = std::move(*__slot(block, i + 1));
+        }
+        *__slot(block, offset) = std::move(element);
+    } else {
+        // 后半部分整体后移一位
+        __pushBack(block, std::move(*__slot(block, block.count - 1)));
+        for (size_type i{block.count - 2}; i > offset; --i) {
+            *__slot(block, i) = std::move(*__slot(block, i - 1));
+        }
+        *__slot(block, offset) = std::move(element);
+    }
+}
+
+template <typename ElementType, typename Allocator>
+ElementType TieredList<ElementType, Allocator>::__eraseFromBlock(__Block &block, size_type offset) {
+#ifdef DEBUG
+    assert(offset < block.count);
+#endif
+    ElementType old{std::move(*__slot(block, offset))};
+    if (offset < block.count / 2) {
+        for (size_type i{offset}; i > 0; --i) {
+            *__slot(block, i) = std::move(*__slot(block, i - 1));
+        }
+        AllocatorTraits::destroy(__allocator, __slot(block, 0));
+        block.head = (block.head + 1) & __blockMask();
+    } else {
+        for (size_type i{offset}; i + 1 < block.count; ++i) {
+            *__slot(block, i) = std::move(*__slot(block, i + 1));
+        }
+        AllocatorTraits::destroy(__allocator, __slot(block, block.count - 1));
+    }
+    --block.count;
+    return old;
+}
+
+template <typename ElementType, typename Allocator>
+template <typename... Args>
+ElementType &TieredList<ElementType, Allocator>::__emplaceAt(size_type index, Args &&...args) {
+    // 参数可能引用集合内部的元素，移动元素前先构造出来
+    ElementType value(std::forward<Args>(args)...);
+    if (__blocks.empty() || __blocks.back().count == blockCapacity()) {
+        __appendBlock();
+    }
+    size_type blockIndex{index >> __blockShift};
+    // 从最后一块开始，每一块从前一块的尾部接过一个元素到自己的头部，为目标块腾出一个空位
+    for (size_type i{__blocks.size() - 1}; i > blockIndex; --i) {
+        __pushFront(__blocks[i], __popBack(__blocks[i - 1]));
+    }
+    __insertIntoBlock(__blocks[blockIndex], index & __blockMask(), std::move(value));
+    ++__size;
+    __rebalanceIfNecessary();
+    return __at(index);
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::__rebalanceIfNecessary() {
+    size_type capacity{blockCapacity()};
+    size_type newBlockShift{__blockShift};
+    if (__size > 4 * capacity * capacity) {
+        newBlockShift = __blockShift + 1;
+    } else if (__blockShift > __MIN_BLOCK_SHIFT && __size < capacity * capacity / 4) {
+        newBlockShift = __blockShift - 1;
+    } else {
+        return;
+    }
+    try {
+        __rebuild(newBlockShift);
+    } catch (const std::bad_alloc &) {
+        // 重建只是调整块容量，调用方的修改已经完成；新块分配失败时集合保持原样，下次修改时再尝试
+    }
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::__rebuild(size_type newBlockShift) {
+    size_type newCapacity{size_type{1} << newBlockShift};
+    size_type blockCount{(__size + newCapacity - 1) / newCapacity};
+    // 先分配好全部新块再移动元素，分配失败时集合保持不变，已分配的新块全部释放
+    std::vector<__Block, __BlockAllocator> blocks(__BlockAllocator{__allocator});
+    blocks.reserve(blockCount);
+    try {
+        while (blocks.size() < blockCount) {
+            blocks.push_back(__Block{AllocatorTraits::allocate(__allocator, newCapacity), 0, 0});
+        }
+    } catch (...) {
+        for (__Block &block : blocks) {
+            AllocatorTraits::deallocate(__allocator, block.data, newCapacity);
+        }
+        throw;
+    }
+    blocks.swap(__blocks);
+    size_type oldShift{std::exchange(__blockShift, newBlockShift)};
+    size_type target{0};
+    for (__Block &oldBlock : blocks) {
+        for (size_type offset{0}; offset < oldBlock.count; ++offset) {
+            if (__blocks[target].count == newCapacity) {
+                ++target;
+            }
+            ElementType *element{oldBlock.data + ((oldBlock.head + offset) & ((size_type{1} << oldShift) - 1))};
+            __pushBack(__blocks[target], std::move(*element));
+            AllocatorTraits::destroy(__allocator, element);
+        }
+        AllocatorTraits::deallocate(__allocator, oldBlock.data, size_type{1} << oldShift);
+    }
+}
+
+template <typename ElementType, typename Allocator>
+void TieredList<ElementType, Allocator>::__releaseBlocks() {
+    for (__Block &block : __blocks) {
+        __destroyBlock(block);
+        __deallocateBlock(block);
+    }
+    __blocks.clear();
+}
+
+} // namespace dsa
+
+#endif
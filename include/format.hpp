@@ -0,0 +1,121 @@
+#ifndef __FORMAT_H__
+#define __FORMAT_H__
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 09:12:40
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 09:12:40
+ * @FilePath     : /include/format.hpp
+ * @Description  : 集合的流式格式化，直接写入输出迭代器，不为每个元素创建临时字符串。
+ *                 Formatter 为可调用对象，调用方式为 out = formatter(out, element)，返回写入后的输出迭代器
+ */
+namespace dsa {
+
+/*
+ * @Description  : 默认的元素格式化方式：算术类型通过 std::to_chars 写入栈上的缓冲区，bool 写为 true/false，
+ *                 字符写为字符本身，可以转换为 std::string_view 的类型直接复制
+ */
+struct DefaultFormatter {
+    template <typename OutputIt, typename T>
+    OutputIt operator()(OutputIt out, const T &value) const {
+        if constexpr (std::is_same_v<T, bool>) {
+            std::string_view text{value ? "true" : "false"};
+            return std::copy(text.begin(), text.end(), out);
+        } else if constexpr (std::is_same_v<T, char>) {
+            *out = value;
+            return ++out;
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            // 足够容纳任意整数和最短表示的 long double
+            char buffer[64];
+            auto result{std::to_chars(buffer, buffer + sizeof(buffer), value)};
+            return std::copy(buffer, result.ptr, out);
+        } else if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+            std::string_view text{value};
+            return std::copy(text.begin(), text.end(), out);
+        } else {
+            static_assert(std::is_arithmetic_v<T>, "DefaultFormatter cannot format this type, pass a custom formatter");
+            return out;
+        }
+    }
+};
+
+/*
+ * @Description  : 把返回 std::string 的旧式 toString 函数适配为 Formatter，用于兼容 toString 接口
+ */
+template <typename ToString>
+class ToStringFormatter {
+public:
+    explicit ToStringFormatter(ToString toString) :
+        __toString{std::move(toString)} {
+    }
+
+    template <typename OutputIt, typename T>
+    OutputIt operator()(OutputIt out, const T &value) const {
+        const std::string &text{__toString(value)};
+        return std::copy(text.begin(), text.end(), out);
+    }
+
+private:
+    ToString __toString;
+};
+
+/**
+ * @description: 将 [first, last) 格式化为 "[e1, e2, ...]" 写入 out
+ * @param       {InputIt} first 起始迭代器
+ * @param       {InputIt} last 末尾迭代器
+ * @param       {OutputIt} out 字符输出迭代器
+ * @param       {Formatter} formatter 元素格式化方法
+ * @return      {OutputIt} 写入后的输出迭代器
+ */
+template <typename InputIt, typename OutputIt, typename Formatter = DefaultFormatter>
+OutputIt formatRange(InputIt first, InputIt last, OutputIt out, Formatter formatter = Formatter{}) {
+    *out = '[';
+    ++out;
+    for (bool isFirst{true}; first != last; ++first, isFirst = false) {
+        if (!isFirst) {
+            *out = ',';
+            ++out;
+            *out = ' ';
+            ++out;
+        }
+        out = formatter(out, *first);
+    }
+    *out = ']';
+    return ++out;
+}
+
+/**
+ * @description: 与 formatRange 相同，但通过 getUnchecked(index) 按索引访问 [0, size) 的元素，供没有迭代器的集合使用
+ * @return      {OutputIt} 写入后的输出迭代器
+ */
+template <typename List, typename OutputIt, typename Formatter>
+OutputIt formatIndexed(const List &list, std::size_t size, OutputIt out, Formatter formatter) {
+    *out = '[';
+    ++out;
+    for (std::size_t i = 0; i < size; ++i) {
+        if (i != 0) {
+            *out = ',';
+            ++out;
+            *out = ' ';
+            ++out;
+        }
+        out = formatter(out, list.getUnchecked(i));
+    }
+    *out = ']';
+    return ++out;
+}
+
+} // namespace dsa
+
+#endif
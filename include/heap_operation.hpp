@@ -2,104 +2,287 @@
 #define __HEAD_OPERATION_H__
 
 #include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
 #include <vector>
 
 /*
  * @Author       : sphc
  * @Date         : 2023-11-07 12:06:11
  * @LastEditors  : sphc
- * @LastEditTime : 2023-11-08 22:07:04
+ * @LastEditTime : 2026-10-19 22:26:40
  * @FilePath     : /include/heap_operation.hpp
- * @Description  :
+ * @Description  : 堆的基本操作。Arity 为每个节点的子节点数（默认为二叉堆），
+ *                 节点 i 的子节点为 [i * Arity + 1, i * Arity + Arity]，父节点为 (i - 1) / Arity。
+ *                 4 叉、8 叉堆的子节点落在同一条缓存行内，树高也更低，适合较大的堆。
+ *                 Compare 为严格弱序，comp(a, b) 为 true 表示 a 的优先级低于 b，默认 std::less 为大顶堆，std::greater 为小顶堆。
+ *                 调整时先把待调整的元素取出留下一个空位，沿路径移动空位，每层只移动一次元素而不是交换
  */
 namespace dsa {
 
-void __checkHeapOperationParam(std::size_t heapSize, std::size_t root, std::size_t bottom);
+inline void __checkHeapOperationParam([[maybe_unused]] std::size_t heapSize, [[maybe_unused]] std::size_t root, [[maybe_unused]] std::size_t bottom) noexcept {
+    assert(root < heapSize);
+    assert(bottom < heapSize);
+    assert(root <= bottom);
+}
 
-namespace recursion {
+namespace __detail {
 
-template <typename ElementType>
-void reshapeDown(std::vector<ElementType> &elements, decltype(elements.size()) root, decltype(elements.size()) bottom) {
-    __checkHeapOperationParam(elements.size(), root, bottom);
+template <std::size_t Arity>
+constexpr std::size_t __heapFirstChild(std::size_t index) noexcept {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
+    return index * Arity + 1;
+}
+
+template <std::size_t Arity>
+constexpr std::size_t __heapParent(std::size_t index) noexcept {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
+    return (index - 1) / Arity;
+}
+
+/**
+ * @description: 在 [firstChild, min(firstChild + Arity - 1, bottom)] 中找出最大的子节点，调用方保证 firstChild <= bottom
+ * @return      {std::size_t} 最大子节点的下标
+ */
+template <std::size_t Arity, typename RandomAccessIterator, typename Compare>
+std::size_t __heapMaxChild(RandomAccessIterator first, std::size_t firstChild, std::size_t bottom, Compare &comp) {
+    std::size_t maxChild{firstChild};
+    std::size_t lastChild{bottom - firstChild < Arity - 1 ? bottom : firstChild + Arity - 1};
+    for (std::size_t child = firstChild + 1; child <= lastChild; ++child) {
+        if (comp(first[maxChild], first[child])) {
+            maxChild = child;
+        }
+    }
+    return maxChild;
+}
 
-    decltype(elements.size()) leftChild = root * 2 + 1;
-    if (bottom < leftChild) {
+/**
+ * @description: 默认的位置观察者。调整过程中每当 first[index] 放入了新的元素就会调用 observer(index)，
+ *               需要记录元素在堆中位置的调用方（如 IndexedPQType）可以借此更新位置
+ */
+struct __NoopHeapObserver {
+    constexpr void operator()(std::size_t) const noexcept {}
+};
+
+/**
+ * @description: 空位 hole 向下移动，较大的子节点依次上移填补空位，直到 value 不小于所有子节点
+ * @return      {std::size_t} value 最终应放入的位置
+ */
+template <std::size_t Arity, typename RandomAccessIterator, typename T, typename Compare, typename Observer>
+std::size_t __siftHoleDown(RandomAccessIterator first, std::size_t hole, std::size_t bottom, const T &value, Compare &comp, Observer &observer) {
+    while (true) {
+        std::size_t firstChild{__heapFirstChild<Arity>(hole)};
+        if (bottom < firstChild) {
+            return hole;
+        }
+        std::size_t maxChild{__heapMaxChild<Arity>(first, firstChild, bottom, comp)};
+        if (!comp(value, first[maxChild])) {
+            return hole;
+        }
+        first[hole] = std::move(first[maxChild]);
+        observer(hole);
+        hole = maxChild;
+    }
+}
+
+/**
+ * @description: 空位 hole 向上移动，较小的父节点依次下移填补空位，直到父节点不小于 value 或到达 root
+ * @return      {std::size_t} value 最终应放入的位置
+ */
+template <std::size_t Arity, typename RandomAccessIterator, typename T, typename Compare, typename Observer>
+std::size_t __siftHoleUp(RandomAccessIterator first, std::size_t root, std::size_t hole, const T &value, Compare &comp, Observer &observer) {
+    while (hole != root) {
+        std::size_t parent{__heapParent<Arity>(hole)};
+        if (!comp(first[parent], value)) {
+            break;
+        }
+        first[hole] = std::move(first[parent]);
+        observer(hole);
+        hole = parent;
+    }
+    return hole;
+}
+
+/**
+ * @description: 将 first[root] 向下调整，堆的范围为 first[0, bottom]
+ * @return      {void}
+ */
+template <std::size_t Arity, typename RandomAccessIterator, typename Compare, typename Observer>
+void __reshapeDown(RandomAccessIterator first, std::size_t root, std::size_t bottom, Compare &comp, Observer &observer) {
+    if (bottom < __heapFirstChild<Arity>(root)) {
         return;
     }
-    decltype(elements.size()) rightChild = leftChild + 1;
-    decltype(elements.size()) maxChild;
-    if (bottom < rightChild) {
-        maxChild = leftChild;
-    } else {
-        maxChild = elements[leftChild] < elements[rightChild] ? rightChild : leftChild;
+    typename std::iterator_traits<RandomAccessIterator>::value_type value(std::move(first[root]));
+    std::size_t hole{__siftHoleDown<Arity>(first, root, bottom, value, comp, observer)};
+    first[hole] = std::move(value);
+    observer(hole);
+}
+
+template <std::size_t Arity, typename RandomAccessIterator, typename Compare>
+void __reshapeDown(RandomAccessIterator first, std::size_t root, std::size_t bottom, Compare &comp) {
+    __NoopHeapObserver observer{};
+    __reshapeDown<Arity>(first, root, bottom, comp, observer);
+}
+
+/**
+ * @description: 将 first[bottom] 向上调整，直到 root 为止
+ * @return      {void}
+ */
+template <std::size_t Arity, typename RandomAccessIterator, typename Compare, typename Observer>
+void __reshapeUp(RandomAccessIterator first, std::size_t root, std::size_t bottom, Compare &comp, Observer &observer) {
+    if (bottom == root) {
+        return;
     }
-    if (elements[root] < elements[maxChild]) {
-        std::swap(elements[root], elements[maxChild]);
-        reshapeDown(elements, maxChild, bottom);
+    typename std::iterator_traits<RandomAccessIterator>::value_type value(std::move(first[bottom]));
+    std::size_t hole{__siftHoleUp<Arity>(first, root, bottom, value, comp, observer)};
+    first[hole] = std::move(value);
+    observer(hole);
+}
+
+template <std::size_t Arity, typename RandomAccessIterator, typename Compare>
+void __reshapeUp(RandomAccessIterator first, std::size_t root, std::size_t bottom, Compare &comp) {
+    __NoopHeapObserver observer{};
+    __reshapeUp<Arity>(first, root, bottom, comp, observer);
+}
+
+/**
+ * @description: Floyd 自底向上调整：空位 root 不与 value 比较，沿较大子节点一直下移到叶子，再把 value 从叶子向上调整。
+ *               value 通常来自堆的末尾、很可能属于底层，每层比 __reshapeDown 少一次与 value 的比较
+ * @param       {RandomAccessIterator} first 堆的起始位置
+ * @param       {std::size_t} root 空位所在位置
+ * @param       {std::size_t} bottom 堆的最后一个位置
+ * @param       {T &&} value 要放入堆中的元素
+ * @param       {Compare &} comp 比较函数
+ * @return      {void}
+ */
+template <std::size_t Arity, typename RandomAccessIterator, typename T, typename Compare>
+void __reshapeDownBottomUp(RandomAccessIterator first, std::size_t root, std::size_t bottom, T &&value, Compare &comp) {
+    std::size_t hole{root};
+    for (std::size_t firstChild{__heapFirstChild<Arity>(hole)}; firstChild <= bottom; firstChild = __heapFirstChild<Arity>(hole)) {
+        std::size_t maxChild{__heapMaxChild<Arity>(first, firstChild, bottom, comp)};
+        first[hole] = std::move(first[maxChild]);
+        hole = maxChild;
     }
+    __NoopHeapObserver observer{};
+    hole = __siftHoleUp<Arity>(first, root, hole, value, comp, observer);
+    first[hole] = std::forward<T>(value);
 }
 
-template <typename ElementType>
-void reshapeUp(std::vector<ElementType> &elements, decltype(elements.size()) root, decltype(elements.size()) bottom) {
+/**
+ * @description: 将 [begin, end) 调整为按 comp 排列的 Arity 叉堆（默认为大顶堆），从最后一个非叶子节点开始依次向下调整
+ * @return      {void}
+ */
+template <std::size_t Arity = 2, typename RandomAccessIterator,
+          typename Compare = std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>>
+void __buildHeap(RandomAccessIterator begin, RandomAccessIterator end, Compare comp = Compare{}) {
+    auto size{static_cast<std::size_t>(end - begin)};
+    if (size < 2) {
+        return;
+    }
+    // 非叶子节点为 [0, parent(size - 1)]
+    std::size_t internalCount{__heapParent<Arity>(size - 1) + 1};
+    while (0 < internalCount) {
+        __reshapeDown<Arity>(begin, --internalCount, size - 1, comp);
+    }
+}
+
+template <std::size_t Arity = 2, typename ElementType, typename Compare = std::less<ElementType>>
+void __buildHeap(std::vector<ElementType> &elements, Compare comp = Compare{}) {
+    __buildHeap<Arity>(elements.begin(), elements.end(), comp);
+}
+
+} // namespace __detail
+
+namespace recursion {
+
+namespace __detail {
+
+template <std::size_t Arity, typename ElementType, typename Compare>
+std::size_t __siftHoleDown(std::vector<ElementType> &elements, std::size_t hole, std::size_t bottom, const ElementType &value, Compare &comp) {
+    std::size_t firstChild = dsa::__detail::__heapFirstChild<Arity>(hole);
+    if (bottom < firstChild) {
+        return hole;
+    }
+    std::size_t maxChild = dsa::__detail::__heapMaxChild<Arity>(elements.begin(), firstChild, bottom, comp);
+    if (!comp(value, elements[maxChild])) {
+        return hole;
+    }
+    elements[hole] = std::move(elements[maxChild]);
+    return __siftHoleDown<Arity>(elements, maxChild, bottom, value, comp);
+}
+
+template <std::size_t Arity, typename ElementType, typename Compare>
+std::size_t __siftHoleUp(std::vector<ElementType> &elements, std::size_t root, std::size_t hole, const ElementType &value, Compare &comp) {
+    if (hole == root) {
+        return hole;
+    }
+    std::size_t parent = dsa::__detail::__heapParent<Arity>(hole);
+    if (!comp(elements[parent], value)) {
+        return hole;
+    }
+    elements[hole] = std::move(elements[parent]);
+    return __siftHoleUp<Arity>(elements, root, parent, value, comp);
+}
+
+} // namespace __detail
+
+template <std::size_t Arity = 2, typename ElementType, typename Compare = std::less<ElementType>>
+void reshapeDown(std::vector<ElementType> &elements, decltype(elements.size()) root, decltype(elements.size()) bottom, Compare comp = Compare{}) {
     __checkHeapOperationParam(elements.size(), root, bottom);
 
-    if (bottom == root) {
+    if (bottom < dsa::__detail::__heapFirstChild<Arity>(root)) {
         return;
     }
-    decltype(elements.size()) parent = (bottom - 1) / 2;
-    if (elements[parent] < elements[bottom]) {
-        std::swap(elements[parent], elements[bottom]);
-        reshapeUp(elements, root, parent);
+    ElementType value(std::move(elements[root]));
+    auto hole = __detail::__siftHoleDown<Arity>(elements, root, bottom, value, comp);
+    elements[hole] = std::move(value);
+}
+
+template <std::size_t Arity = 2, typename ElementType, typename Compare = std::less<ElementType>>
+void reshapeUp(std::vector<ElementType> &elements, decltype(elements.size()) root, decltype(elements.size()) bottom, Compare comp = Compare{}) {
+    __checkHeapOperationParam(elements.size(), root, bottom);
+
+    if (bottom == root) {
+        return;
     }
+    ElementType value(std::move(elements[bottom]));
+    auto hole = __detail::__siftHoleUp<Arity>(elements, root, bottom, value, comp);
+    elements[hole] = std::move(value);
 }
 
 } // namespace recursion
 
 inline namespace iteration {
 
-template <typename ElementType>
-void reshapeDown(std::vector<ElementType> &elements, decltype(elements.size()) root, decltype(elements.size()) bottom) {
+template <std::size_t Arity = 2, typename ElementType, typename Compare = std::less<ElementType>>
+void reshapeDown(std::vector<ElementType> &elements, decltype(elements.size()) root, decltype(elements.size()) bottom, Compare comp = Compare{}) {
     __checkHeapOperationParam(elements.size(), root, bottom);
+    __detail::__reshapeDown<Arity>(elements.begin(), root, bottom, comp);
+}
 
-    while (true) {
-        decltype(elements.size()) leftChild = root * 2 + 1;
-        if (bottom < leftChild) {
-            break;
-        }
-        decltype(elements.size()) rightChild = leftChild + 1;
-        decltype(elements.size()) maxChild;
-        if (bottom < rightChild) {
-            maxChild = leftChild;
-        } else {
-            maxChild = elements[leftChild] < elements[rightChild] ? rightChild : leftChild;
-        }
-
-        if (elements[root] < elements[maxChild]) {
-            std::swap(elements[root], elements[maxChild]);
-            root = maxChild;
-        } else {
-            break;
-        }
-    }
+template <std::size_t Arity = 2, typename ElementType, typename Compare = std::less<ElementType>>
+void reshapeUp(std::vector<ElementType> &elements, decltype(elements.size()) root, decltype(elements.size()) bottom, Compare comp = Compare{}) {
+    __checkHeapOperationParam(elements.size(), root, bottom);
+    __detail::__reshapeUp<Arity>(elements.begin(), root, bottom, comp);
 }
 
-template <typename ElementType>
-void reshapeUp(std::vector<ElementType> &elements, decltype(elements.size()) root, decltype(elements.size()) bottom) {
+/**
+ * @description: 与 reshapeDown 结果相同的 Floyd 自底向上版本，先把空位下移到叶子再把 elements[root] 向上调整。
+ *               元素比较代价较高、且 elements[root] 很可能属于底层时（例如堆排序中从末尾换上来的元素）比较次数约减半
+ * @return      {void}
+ */
+template <std::size_t Arity = 2, typename ElementType, typename Compare = std::less<ElementType>>
+void reshapeDownBottomUp(std::vector<ElementType> &elements, decltype(elements.size()) root, decltype(elements.size()) bottom, Compare comp = Compare{}) {
     __checkHeapOperationParam(elements.size(), root, bottom);
 
-    while (bottom != root) {
-        decltype(elements.size()) parent = (bottom - 1) / 2;
-        if (elements[parent] < elements[bottom]) {
-            std::swap(elements[parent], elements[bottom]);
-            bottom = parent;
-        } else {
-            break;
-        }
-    }
+    ElementType value(std::move(elements[root]));
+    __detail::__reshapeDownBottomUp<Arity>(elements.begin(), root, bottom, std::move(value), comp);
 }
 
 } // namespace iteration
 
 } // namespace dsa
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,65 @@
+#ifndef __MAPPED_FILE_H__
+#define __MAPPED_FILE_H__
+
+#include <cstddef>
+#include <string>
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 21:20:48
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 21:20:48
+ * @FilePath     : /include/mapped_file.hpp
+ * @Description  : 以 MAP_SHARED 方式映射整个文件的读写映射，扩容通过 ftruncate + mremap 完成，系统调用失败时抛出 std::system_error
+ */
+namespace dsa {
+
+class MappedFile {
+public:
+    /**
+     * @description: 打开文件并映射，文件不存在或为空时创建并扩展到 initialSize 字节
+     * @param       {const std::string &} path 文件路径
+     * @param       {size_t} initialSize 新建文件的初始大小，必须大于 0
+     */
+    MappedFile(const std::string &path, std::size_t initialSize);
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&rhs) noexcept;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile &operator=(MappedFile &&rhs) noexcept;
+    ~MappedFile();
+
+    [[nodiscard]] void *data() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @description: 文件是否由本次打开新建（或打开时为空）
+     * @return      {bool} 新建返回 true
+     */
+    [[nodiscard]] bool created() const noexcept;
+
+    /**
+     * @description: 调整文件和映射的大小，映射地址可能改变，之前取得的指针全部失效
+     * @param       {size_t} newSize 新的大小，必须大于 0
+     * @return      {void}
+     */
+    void resize(std::size_t newSize);
+
+    /**
+     * @description: 将映射中被修改的页写回文件
+     * @param       {bool} async 为 true 时只发起写回（MS_ASYNC），否则等待写回完成（MS_SYNC）
+     * @return      {void}
+     */
+    void sync(bool async = false);
+
+private:
+    int __fd;
+    void *__data;
+    std::size_t __size;
+    bool __created;
+
+    void __close() noexcept;
+};
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,283 @@
+#ifndef __PARALLEL_H__
+#define __PARALLEL_H__
+
+#include "simd_search.hpp"
+#include "thread_pool.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 13:40:05
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-20 11:02:44
+ * @FilePath     : /include/parallel.hpp
+ * @Description  : 连续存储集合上的并行批量算法，区间按块切分后交给 ThreadPool 执行。
+ *                 元素个数小于 cutoff 时直接在调用线程中串行执行，避免小集合承担任务调度的开销。
+ *                 所有函数都接受 Span，也接受提供 span() 的集合（ArrayList、SmallArrayList、MmapArrayList 等）
+ */
+namespace dsa {
+
+namespace parallel {
+
+using size_type = std::size_t;
+
+inline constexpr size_type npos{std::numeric_limits<size_type>::max()};
+// 默认的串行阈值，低于该值时并行带来的收益不足以抵消调度开销
+inline constexpr size_type DEFAULT_CUTOFF{1 << 15};
+// 每块的最小长度
+inline constexpr size_type MIN_CHUNK_SIZE{1 << 12};
+
+namespace __detail {
+
+/**
+ * @description: 计算分块长度，每个线程约分到 8 块，使工作窃取有余地平衡负载
+ * @return      {size_type} 分块长度
+ */
+inline size_type __chunkSize(size_type size, const ThreadPool &pool) noexcept {
+    return std::max(MIN_CHUNK_SIZE, size / ((pool.threadCount() + 1) * 8));
+}
+
+template <typename List, typename = void>
+struct __HasSpan : std::false_type {};
+template <typename List>
+struct __HasSpan<List, std::void_t<decltype(std::declval<List &>().span())>> : std::true_type {};
+
+template <typename T, typename Predicate>
+size_type __findFirstIf(const T *data, size_type size, Predicate &pred) {
+    for (size_type i = 0; i < size; ++i) {
+        if (pred(data[i])) {
+            return i;
+        }
+    }
+    return size;
+}
+
+/**
+ * @description: 并行查找第一个满足条件的位置，某块找到后，起点在其之后的块不再扫描
+ * @param       {ScanChunk} scan 在 [data, data + size) 中查找，返回下标，未找到返回 size
+ * @return      {size_type} 找到返回下标，否则返回 npos
+ */
+template <typename T, typename ScanChunk>
+size_type __findFirst(Span<T> range, ScanChunk scan, size_type cutoff, ThreadPool &pool) {
+    if (range.size() < cutoff) {
+        size_type index{scan(range.data(), range.size())};
+        return index != range.size() ? index : npos;
+    }
+    std::atomic<size_type> first{npos};
+    pool.parallelFor(range.size(), __chunkSize(range.size(), pool), [&](size_type begin, size_type end) {
+        if (begin > first.load(std::memory_order_relaxed)) {
+            return;
+        }
+        size_type index{scan(range.data() + begin, end - begin)};
+        if (index == end - begin) {
+            return;
+        }
+        index += begin;
+        size_type current{first.load(std::memory_order_relaxed)};
+        while (index < current && !first.compare_exchange_weak(current, index, std::memory_order_relaxed)) {
+        }
+    });
+    return first.load(std::memory_order_relaxed);
+}
+
+} // namespace __detail
+
+/**
+ * @description: 对每个元素调用 f，f 会在多个线程中同时被调用，调用顺序不确定
+ * @param       {Span<T>} range 元素区间
+ * @param       {Function} f 以 T & 为参数的函数
+ * @param       {size_type} cutoff 串行阈值
+ * @param       {ThreadPool &} pool 执行任务的线程池
+ * @return      {void} f 抛出异常时，尚未开始的块不再执行，异常在调用线程中重新抛出
+ */
+template <typename T, typename Function>
+void forEach(Span<T> range, Function f, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    if (range.size() < cutoff) {
+        std::for_each(range.begin(), range.end(), f);
+        return;
+    }
+    pool.parallelFor(range.size(), __detail::__chunkSize(range.size(), pool), [&](size_type begin, size_type end) {
+        std::for_each(range.data() + begin, range.data() + end, f);
+    });
+}
+
+/**
+ * @description: out[i] = f(in[i])，in 与 out 可以是同一区间
+ * @param       {Span<T>} in 输入区间
+ * @param       {Span<U>} out 输出区间，长度不能小于输入区间
+ * @param       {Function} f 以 const T & 为参数的函数
+ * @param       {size_type} cutoff 串行阈值
+ * @param       {ThreadPool &} pool 执行任务的线程池
+ * @return      {void}
+ */
+template <typename T, typename U, typename Function>
+void transform(Span<T> in, Span<U> out, Function f, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    if (out.size() < in.size()) {
+        throw std::invalid_argument{"dsa::parallel::transform: output range is shorter than input range"};
+    }
+    if (in.size() < cutoff) {
+        std::transform(in.begin(), in.end(), out.begin(), f);
+        return;
+    }
+    pool.parallelFor(in.size(), __detail::__chunkSize(in.size(), pool), [&](size_type begin, size_type end) {
+        std::transform(in.data() + begin, in.data() + end, out.data() + begin, f);
+    });
+}
+
+/**
+ * @description: 归约所有元素，要求与 std::reduce 相同：R 可以由 T 构造，op 对 R、T 的任意组合都可调用并返回 R，且满足结合律。
+ *               并行时每块以块内第一个元素转换成的 R 为初值，块的结果之间也用 op 合并，因此 op 的两个参数必须可以互换类型；
+ *               各块的结果按块的顺序与 init 合并，不要求交换律。R 与 T 含义不同时（例如统计满足条件的元素个数）使用 aggregate
+ * @param       {Span<T>} range 元素区间
+ * @param       {R} init 初始值
+ * @param       {BinaryOperation} op 满足结合律的二元运算
+ * @param       {size_type} cutoff 串行阈值
+ * @param       {ThreadPool &} pool 执行任务的线程池
+ * @return      {R} 归约结果
+ */
+template <typename T, typename R, typename BinaryOperation>
+R reduce(Span<T> range, R init, BinaryOperation op, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    static_assert(std::is_constructible_v<R, const T &>, "dsa::parallel::reduce: R must be constructible from the element type");
+    static_assert(std::is_invocable_r_v<R, BinaryOperation &, R, R> && std::is_invocable_r_v<R, BinaryOperation &, R, const T &> &&
+                      std::is_invocable_r_v<R, BinaryOperation &, const T &, R> && std::is_invocable_r_v<R, BinaryOperation &, const T &, const T &>,
+                  "dsa::parallel::reduce: op must accept every combination of R and the element type and return R");
+    if (range.size() < cutoff) {
+        for (const auto &element : range) {
+            init = op(std::move(init), element);
+        }
+        return init;
+    }
+    size_type chunkSize{__detail::__chunkSize(range.size(), pool)};
+    std::vector<std::optional<R>> partials((range.size() + chunkSize - 1) / chunkSize);
+    pool.parallelFor(range.size(), chunkSize, [&](size_type begin, size_type end) {
+        R partial(range[begin]);
+        for (size_type i = begin + 1; i < end; ++i) {
+            partial = op(std::move(partial), range[i]);
+        }
+        partials[begin / chunkSize].emplace(std::move(partial));
+    });
+    for (auto &partial : partials) {
+        init = op(std::move(init), std::move(*partial));
+    }
+    return init;
+}
+
+/**
+ * @description: 分两步的归约：每块从 init 的副本开始用 accumulate(R, const T &) 依次累积元素，再按块的顺序用 combine(R, R) 合并各块的结果。
+ *               init 会作为每一块的初值，必须是 combine 的单位元（例如求和为 0、拼接为空串），
+ *               并且 accumulate(combine(a, b), e) 与 combine(a, accumulate(b, e)) 相等，此时结果与串行执行一致
+ * @param       {Span<T>} range 元素区间
+ * @param       {R} init combine 的单位元
+ * @param       {Accumulate} accumulate 将一个元素累积到 R 上
+ * @param       {Combine} combine 满足结合律，合并两个块的结果
+ * @param       {size_type} cutoff 串行阈值
+ * @param       {ThreadPool &} pool 执行任务的线程池
+ * @return      {R} 归约结果
+ */
+template <typename T, typename R, typename Accumulate, typename Combine>
+R aggregate(Span<T> range, R init, Accumulate accumulate, Combine combine, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    static_assert(std::is_invocable_r_v<R, Accumulate &, R, const T &>, "dsa::parallel::aggregate: accumulate must be callable as R(R, const T &)");
+    static_assert(std::is_invocable_r_v<R, Combine &, R, R>, "dsa::parallel::aggregate: combine must be callable as R(R, R)");
+    if (range.size() < cutoff) {
+        for (const auto &element : range) {
+            init = accumulate(std::move(init), element);
+        }
+        return init;
+    }
+    size_type chunkSize{__detail::__chunkSize(range.size(), pool)};
+    std::vector<std::optional<R>> partials((range.size() + chunkSize - 1) / chunkSize);
+    pool.parallelFor(range.size(), chunkSize, [&](size_type begin, size_type end) {
+        R partial(init);
+        for (size_type i = begin; i < end; ++i) {
+            partial = accumulate(std::move(partial), range[i]);
+        }
+        partials[begin / chunkSize].emplace(std::move(partial));
+    });
+    R result(std::move(*partials.front()));
+    for (size_type i = 1; i < partials.size(); ++i) {
+        result = combine(std::move(result), std::move(*partials[i]));
+    }
+    return result;
+}
+
+/**
+ * @description: 查找第一个等于 value 的元素，整数和浮点类型在块内使用向量化查找
+ * @param       {Span<T>} range 元素区间
+ * @param       {const std::remove_cv_t<T> &} value 要查找的值
+ * @param       {size_type} cutoff 串行阈值
+ * @param       {ThreadPool &} pool 执行任务的线程池
+ * @return      {size_type} 找到返回下标，否则返回 npos
+ */
+template <typename T>
+size_type indexOf(Span<T> range, const std::remove_cv_t<T> &value, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    Span<const T> constRange{range};
+    return __detail::__findFirst(
+        constRange, [&value](const T *data, size_type size) {
+            if constexpr (simd::is_searchable_v<T>) {
+                return simd::findFirst(data, size, value);
+            } else {
+                return static_cast<size_type>(std::find(data, data + size, value) - data);
+            }
+        },
+        cutoff, pool);
+}
+
+/**
+ * @description: 查找第一个满足条件的元素
+ * @param       {Span<T>} range 元素区间
+ * @param       {Predicate} pred 以 const T & 为参数的谓词，会在多个线程中同时被调用
+ * @param       {size_type} cutoff 串行阈值
+ * @param       {ThreadPool &} pool 执行任务的线程池
+ * @return      {size_type} 找到返回下标，否则返回 npos
+ */
+template <typename T, typename Predicate>
+size_type indexOfIf(Span<T> range, Predicate pred, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    Span<const T> constRange{range};
+    return __detail::__findFirst(
+        constRange, [&pred](const T *data, size_type size) { return __detail::__findFirstIf(data, size, pred); }, cutoff, pool);
+}
+
+template <typename List, typename Function, typename = std::enable_if_t<__detail::__HasSpan<List>::value>>
+void forEach(List &list, Function f, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    forEach(list.span(), std::move(f), cutoff, pool);
+}
+
+template <typename InList, typename OutList, typename Function, typename = std::enable_if_t<__detail::__HasSpan<InList>::value && __detail::__HasSpan<OutList>::value>>
+void transform(InList &in, OutList &out, Function f, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    transform(in.span(), out.span(), std::move(f), cutoff, pool);
+}
+
+template <typename List, typename R, typename BinaryOperation, typename = std::enable_if_t<__detail::__HasSpan<List>::value>>
+R reduce(const List &list, R init, BinaryOperation op, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    return reduce(list.span(), std::move(init), std::move(op), cutoff, pool);
+}
+
+template <typename List, typename R, typename Accumulate, typename Combine, typename = std::enable_if_t<__detail::__HasSpan<List>::value>>
+R aggregate(const List &list, R init, Accumulate accumulate, Combine combine, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    return aggregate(list.span(), std::move(init), std::move(accumulate), std::move(combine), cutoff, pool);
+}
+
+template <typename List, typename = std::enable_if_t<__detail::__HasSpan<List>::value>>
+size_type indexOf(const List &list, const typename List::value_type &value, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    return indexOf(list.span(), value, cutoff, pool);
+}
+
+template <typename List, typename Predicate, typename = std::enable_if_t<__detail::__HasSpan<List>::value>>
+size_type indexOfIf(const List &list, Predicate pred, size_type cutoff = DEFAULT_CUTOFF, ThreadPool &pool = ThreadPool::global()) {
+    return indexOfIf(list.span(), std::move(pred), cutoff, pool);
+}
+
+} // namespace parallel
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef __SIMD_SEARCH_H__
+#define __SIMD_SEARCH_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 15:42:10
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 15:42:10
+ * @FilePath     : /include/simd_search.hpp
+ * @Description  : 基于 SSE2/AVX2 的连续内存线性查找，运行时根据 CPU 支持的指令集选择实现
+ */
+namespace dsa {
+
+namespace simd {
+
+enum class InstructionSet {
+    SCALAR,
+    SSE2,
+    AVX2
+};
+
+/**
+ * @description: 检测当前 CPU 支持的最高指令集
+ * @return      {InstructionSet} 支持的最高指令集
+ */
+InstructionSet detectInstructionSet() noexcept;
+
+/**
+ * @description: 获取查找函数当前使用的指令集，默认为 detectInstructionSet() 的结果
+ * @return      {InstructionSet} 当前使用的指令集
+ */
+InstructionSet getInstructionSet() noexcept;
+
+/**
+ * @description: 指定查找函数使用的指令集，超出 CPU 支持范围时降级为支持的最高指令集，主要用于测试和性能对比
+ * @param       {InstructionSet} instructionSet 期望使用的指令集
+ * @return      {InstructionSet} 实际使用的指令集
+ */
+InstructionSet setInstructionSet(InstructionSet instructionSet) noexcept;
+
+namespace __detail {
+
+std::size_t __findFirst(const void *data, std::size_t size, std::uint8_t value) noexcept;
+std::size_t __findFirst(const void *data, std::size_t size, std::uint16_t value) noexcept;
+std::size_t __findFirst(const void *data, std::size_t size, std::uint32_t value) noexcept;
+std::size_t __findFirst(const void *data, std::size_t size, std::uint64_t value) noexcept;
+std::size_t __findFirst(const void *data, std::size_t size, float value) noexcept;
+std::size_t __findFirst(const void *data, std::size_t size, double value) noexcept;
+
+std::size_t __findLast(const void *data, std::size_t size, std::uint8_t value) noexcept;
+std::size_t __findLast(const void *data, std::size_t size, std::uint16_t value) noexcept;
+std::size_t __findLast(const void *data, std::size_t size, std::uint32_t value) noexcept;
+std::size_t __findLast(const void *data, std::size_t size, std::uint64_t value) noexcept;
+std::size_t __findLast(const void *data, std::size_t size, float value) noexcept;
+std::size_t __findLast(const void *data, std::size_t size, double value) noexcept;
+
+std::size_t __count(const void *data, std::size_t size, std::uint8_t value) noexcept;
+std::size_t __count(const void *data, std::size_t size, std::uint16_t value) noexcept;
+std::size_t __count(const void *data, std::size_t size, std::uint32_t value) noexcept;
+std::size_t __count(const void *data, std::size_t size, std::uint64_t value) noexcept;
+std::size_t __count(const void *data, std::size_t size, float value) noexcept;
+std::size_t __count(const void *data, std::size_t size, double value) noexcept;
+
+template <std::size_t Size>
+struct __UnsignedOfSize;
+template <>
+struct __UnsignedOfSize<1> {
+    using type = std::uint8_t;
+};
+template <>
+struct __UnsignedOfSize<2> {
+    using type = std::uint16_t;
+};
+template <>
+struct __UnsignedOfSize<4> {
+    using type = std::uint32_t;
+};
+template <>
+struct __UnsignedOfSize<8> {
+    using type = std::uint64_t;
+};
+
+template <typename T, typename = void>
+struct __LaneOf {};
+template <typename T>
+struct __LaneOf<T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>>> {
+    using type = T;
+};
+template <typename T>
+struct __LaneOf<T, std::enable_if_t<std::is_integral_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)>> {
+    // 整数的相等比较等价于按位比较，统一按同宽度的无符号整数处理
+    using type = typename __UnsignedOfSize<sizeof(T)>::type;
+};
+
+template <typename T>
+typename __LaneOf<T>::type __toLane(const T &value) noexcept {
+    typename __LaneOf<T>::type lane;
+    std::memcpy(&lane, &value, sizeof(T));
+    return lane;
+}
+
+template <typename T, typename = void>
+struct __IsSearchable : std::false_type {};
+template <typename T>
+struct __IsSearchable<T, std::void_t<typename __LaneOf<T>::type>> : std::true_type {};
+
+} // namespace __detail
+
+// 是否可以使用向量化查找：整数类型以及 float、double
+template <typename T>
+inline constexpr bool is_searchable_v{__detail::__IsSearchable<std::remove_cv_t<T>>::value};
+
+/**
+ * @description: 查找 value 在 [data, data + size) 中第一次出现的位置
+ * @return      {std::size_t} 找到返回下标，否则返回 size
+ */
+template <typename T, typename = std::enable_if_t<is_searchable_v<T>>>
+std::size_t findFirst(const T *data, std::size_t size, const T &value) noexcept {
+    return __detail::__findFirst(data, size, __detail::__toLane(value));
+}
+
+/**
+ * @description: 查找 value 在 [data, data + size) 中最后一次出现的位置
+ * @return      {std::size_t} 找到返回下标，否则返回 size
+ */
+template <typename T, typename = std::enable_if_t<is_searchable_v<T>>>
+std::size_t findLast(const T *data, std::size_t size, const T &value) noexcept {
+    return __detail::__findLast(data, size, __detail::__toLane(value));
+}
+
+/**
+ * @description: 统计 value 在 [data, data + size) 中出现的次数
+ * @return      {std::size_t} 出现次数
+ */
+template <typename T, typename = std::enable_if_t<is_searchable_v<T>>>
+std::size_t count(const T *data, std::size_t size, const T &value) noexcept {
+    return __detail::__count(data, size, __detail::__toLane(value));
+}
+
+} // namespace simd
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,338 @@
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+#include "utility.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 22:24:37
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-21 10:26:18
+ * @FilePath     : /include/snapshot.hpp
+ * @Description  : 集合的二进制快照。快照由 32 字节的 SnapshotHeader 和负载组成：
+ *                 平凡可复制的元素直接按内存表示写出（RAW），写文件描述符时头部和负载通过一次 writev 写出，
+ *                 读取时可以用 viewSnapshot 直接在只读缓冲区（例如 mmap 的文件）上零拷贝访问；
+ *                 其他元素通过可替换的 Codec 逐个流式编码（ENCODED），Codec 需要提供
+ *                 void encode(std::ostream &, const T &) const 和 T decode(std::istream &) const
+ */
+namespace dsa {
+
+namespace snapshot {
+
+struct SnapshotHeader {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t flags;
+    // RAW 快照为 sizeof(T)，ENCODED 快照为 0
+    std::uint64_t elementSize;
+    std::uint64_t count;
+};
+static_assert(sizeof(SnapshotHeader) == 32 && std::is_trivially_copyable_v<SnapshotHeader>);
+
+inline constexpr std::uint64_t MAGIC{0x0050414e53415344ULL}; // "DSASNAP"
+inline constexpr std::uint32_t VERSION{1};
+inline constexpr std::uint32_t FLAG_RAW{1U << 0};
+inline constexpr std::uint32_t FLAG_ENCODED{1U << 1};
+
+/**
+ * @description: 元素的默认编解码器，非平凡可复制的类型需要特化或者在读写时传入自定义的 Codec
+ */
+template <typename T>
+struct SnapshotCodec;
+
+/**
+ * @description: 字符串编码为 uint64 长度加字符内容。解码时长度来自不可信的输入，按固定大小分块读取，
+ *               损坏或截断的快照最多多申请一块内存，随后抛出 std::runtime_error
+ */
+template <typename CharT, typename Traits, typename Alloc>
+struct SnapshotCodec<std::basic_string<CharT, Traits, Alloc>> {
+    using String = std::basic_string<CharT, Traits, Alloc>;
+
+    // 每次最多读取的字符数
+    static constexpr std::size_t CHUNK_LENGTH{(std::size_t{1} << 16) / sizeof(CharT)};
+
+    void encode(std::ostream &os, const String &value) const {
+        std::uint64_t length{value.size()};
+        os.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        os.write(reinterpret_cast<const char *>(value.data()), static_cast<std::streamsize>(length * sizeof(CharT)));
+    }
+
+    String decode(std::istream &is) const {
+        std::uint64_t length{0};
+        if (!is.read(reinterpret_cast<char *>(&length), sizeof(length))) {
+            throw std::runtime_error{"snapshot stream is truncated"};
+        }
+        String value{};
+        if (length > value.max_size()) {
+            throw std::runtime_error{"snapshot string length " + std::to_string(length) + " is invalid"};
+        }
+        while (value.size() < length) {
+            std::size_t offset{value.size()};
+            std::size_t chunk{static_cast<std::size_t>(std::min<std::uint64_t>(length - offset, CHUNK_LENGTH))};
+            value.resize(offset + chunk);
+            if (!is.read(reinterpret_cast<char *>(value.data() + offset), static_cast<std::streamsize>(chunk * sizeof(CharT)))) {
+                throw std::runtime_error{"snapshot stream is truncated"};
+            }
+        }
+        return value;
+    }
+};
+
+/*
+ * @Description  : RAW 快照的零拷贝只读视图，元素直接指向原缓冲区，缓冲区必须比视图活得久
+ */
+template <typename T>
+class SnapshotView {
+public:
+    using size_type = std::size_t;
+    using iterator = const T *;
+
+    constexpr SnapshotView() noexcept = default;
+    constexpr explicit SnapshotView(Span<const T> elements) noexcept :
+        __elements{elements} {
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return __elements.size();
+    }
+
+    [[nodiscard]] constexpr bool isEmpty() const noexcept {
+        return __elements.empty();
+    }
+
+    [[nodiscard]] constexpr const T *data() const noexcept {
+        return __elements.data();
+    }
+
+    [[nodiscard]] constexpr Span<const T> span() const noexcept {
+        return __elements;
+    }
+
+    constexpr const T &operator[](size_type index) const noexcept {
+        return __elements[index];
+    }
+
+    constexpr iterator begin() const noexcept {
+        return __elements.begin();
+    }
+
+    constexpr iterator end() const noexcept {
+        return __elements.end();
+    }
+
+private:
+    Span<const T> __elements;
+};
+
+namespace __detail {
+
+/**
+ * @description: 通过 writev 写出头部和负载，处理部分写入和 EINTR，失败时抛出 std::system_error
+ * @return      {void}
+ */
+void __writeRaw(int fd, const SnapshotHeader &header, const void *payload, std::size_t bytes);
+
+/**
+ * @description: 检查头部的魔数、版本、格式和元素大小，不匹配时抛出 std::runtime_error
+ * @return      {void}
+ */
+void __checkHeader(const SnapshotHeader &header, std::uint32_t expectedFlag, std::uint64_t expectedElementSize);
+
+template <typename T>
+SnapshotHeader __makeHeader(std::uint32_t flag, std::size_t count) noexcept {
+    return SnapshotHeader{MAGIC, VERSION, flag, flag == FLAG_RAW ? sizeof(T) : 0, count};
+}
+
+SnapshotHeader __readHeader(std::istream &is);
+
+/**
+ * @description: 获取输入流从当前位置到末尾的字节数，不支持定位的流返回 -1，流的读取位置保持不变
+ * @return      {streamoff} 剩余字节数
+ */
+std::streamoff __remainingBytes(std::istream &is);
+
+// RAW 负载批量读取时每块的字节数
+inline constexpr std::size_t __RAW_CHUNK_BYTES{std::size_t{1} << 20};
+
+template <typename List, typename = void>
+struct __hasBulkAppend : std::false_type {};
+
+template <typename List>
+struct __hasBulkAppend<List, std::void_t<decltype(std::declval<List &>().reserve(std::size_t{})),
+                                         decltype(std::declval<List &>().addAll(std::declval<const typename List::value_type *>(), std::declval<const typename List::value_type *>()))>>
+    : std::true_type {};
+
+/**
+ * @description: 读取 count 个 RAW 元素追加到集合末尾。提供 reserve 和 addAll 的集合按大块读取并批量追加，
+ *               可定位的流先确认剩余字节足够再一次预留全部容量；其他集合逐个读取
+ * @return      {void}
+ */
+template <typename List>
+void __readRaw(std::istream &is, List &list, std::uint64_t count) {
+    using T = typename List::value_type;
+    if constexpr (__hasBulkAppend<List>::value) {
+        std::streamoff remaining{__remainingBytes(is)};
+        if (remaining >= 0) {
+            if (count > static_cast<std::uint64_t>(remaining) / sizeof(T)) {
+                throw std::runtime_error{"snapshot stream is truncated"};
+            }
+            list.reserve(list.size() + static_cast<std::size_t>(count));
+        }
+        // 数量来自不可信的输入，缓冲区不超过一块
+        std::size_t chunkLength{static_cast<std::size_t>(std::min<std::uint64_t>(count, std::max<std::size_t>(__RAW_CHUNK_BYTES / sizeof(T), 1)))};
+        std::unique_ptr<T[]> buffer{new T[chunkLength]};
+        for (std::uint64_t done = 0; done < count;) {
+            std::size_t length{static_cast<std::size_t>(std::min<std::uint64_t>(count - done, chunkLength))};
+            if (!is.read(reinterpret_cast<char *>(buffer.get()), static_cast<std::streamsize>(length * sizeof(T)))) {
+                throw std::runtime_error{"snapshot stream is truncated"};
+            }
+            list.addAll(buffer.get(), buffer.get() + length);
+            done += length;
+        }
+    } else {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            T element;
+            if (!is.read(reinterpret_cast<char *>(&element), sizeof(T))) {
+                throw std::runtime_error{"snapshot stream is truncated"};
+            }
+            list.add(std::move(element));
+        }
+    }
+}
+
+} // namespace __detail
+
+/**
+ * @description: 将平凡可复制的元素以 RAW 格式写入文件描述符，头部和负载只需一次 writev
+ * @param       {int} fd 可写的文件描述符
+ * @param       {Span<T>} elements 要写出的元素，可由各连续集合的 span() 得到
+ * @return      {void}
+ */
+template <typename T>
+void writeSnapshot(int fd, Span<T> elements) {
+    using Element = std::remove_const_t<T>;
+    static_assert(std::is_trivially_copyable_v<Element>, "writing to a file descriptor requires a trivially copyable element type");
+    __detail::__writeRaw(fd, __detail::__makeHeader<Element>(FLAG_RAW, elements.size()), elements.data(), elements.size() * sizeof(Element));
+}
+
+/**
+ * @description: 用指定的 Codec 以 ENCODED 格式将元素逐个写入输出流
+ * @param       {ostream &} os 输出流
+ * @param       {Span<T>} elements 要写出的元素
+ * @param       {const Codec &} codec 元素编码器
+ * @return      {void}
+ */
+template <typename T, typename Codec>
+void writeSnapshot(std::ostream &os, Span<T> elements, const Codec &codec) {
+    SnapshotHeader header{__detail::__makeHeader<std::remove_const_t<T>>(FLAG_ENCODED, elements.size())};
+    os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const auto &element : elements) {
+        codec.encode(os, element);
+    }
+}
+
+/**
+ * @description: 将元素写入输出流，平凡可复制的元素使用 RAW 格式一次写出，否则使用 SnapshotCodec<T> 编码
+ * @param       {ostream &} os 输出流
+ * @param       {Span<T>} elements 要写出的元素
+ * @return      {void}
+ */
+template <typename T>
+void writeSnapshot(std::ostream &os, Span<T> elements) {
+    using Element = std::remove_const_t<T>;
+    if constexpr (std::is_trivially_copyable_v<Element>) {
+        SnapshotHeader header{__detail::__makeHeader<Element>(FLAG_RAW, elements.size())};
+        os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        os.write(reinterpret_cast<const char *>(elements.data()), static_cast<std::streamsize>(elements.size() * sizeof(Element)));
+    } else {
+        writeSnapshot(os, elements, SnapshotCodec<Element>{});
+    }
+}
+
+/**
+ * @description: 在只读缓冲区上零拷贝地打开 RAW 快照，格式不匹配、缓冲区过小或负载未对齐时抛出 std::runtime_error
+ * @param       {const void *} buffer 快照所在的缓冲区
+ * @param       {size_t} bytes 缓冲区大小
+ * @return      {SnapshotView<T>} 快照视图
+ */
+template <typename T>
+SnapshotView<T> viewSnapshot(const void *buffer, std::size_t bytes) {
+    static_assert(std::is_trivially_copyable_v<T>, "zero-copy view requires a trivially copyable element type");
+    if (bytes < sizeof(SnapshotHeader)) {
+        throw std::runtime_error{"snapshot buffer is smaller than its header"};
+    }
+    SnapshotHeader header;
+    std::memcpy(&header, buffer, sizeof(header));
+    __detail::__checkHeader(header, FLAG_RAW, sizeof(T));
+    if (header.count > (bytes - sizeof(SnapshotHeader)) / sizeof(T)) {
+        throw std::runtime_error{"snapshot buffer is truncated"};
+    }
+    const unsigned char *payload{static_cast<const unsigned char *>(buffer) + sizeof(SnapshotHeader)};
+    if (reinterpret_cast<std::uintptr_t>(payload) % alignof(T) != 0) {
+        throw std::runtime_error{"snapshot payload is not suitably aligned"};
+    }
+    return SnapshotView<T>{Span<const T>{reinterpret_cast<const T *>(payload), static_cast<std::size_t>(header.count)}};
+}
+
+/**
+ * @description: 从输入流读取快照并把元素依次追加到集合末尾，RAW 和 ENCODED 格式都支持；
+ *               集合同时提供 reserve 和 addAll 时 RAW 负载按大块读取
+ * @param       {istream &} is 输入流
+ * @param       {List &} list 任何提供 value_type 和 add(value_type &&) 的集合
+ * @param       {const Codec &} codec 读取 ENCODED 快照使用的解码器
+ * @return      {size_t} 读取的元素数量
+ */
+template <typename List, typename Codec>
+std::size_t readSnapshot(std::istream &is, List &list, const Codec &codec) {
+    using T = typename List::value_type;
+    SnapshotHeader header{__detail::__readHeader(is)};
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (header.flags == FLAG_RAW) {
+            __detail::__checkHeader(header, FLAG_RAW, sizeof(T));
+            __detail::__readRaw(is, list, header.count);
+            return static_cast<std::size_t>(header.count);
+        }
+    }
+    __detail::__checkHeader(header, FLAG_ENCODED, 0);
+    for (std::uint64_t i = 0; i < header.count; ++i) {
+        T element{codec.decode(is)};
+        if (!is) {
+            throw std::runtime_error{"snapshot stream is truncated"};
+        }
+        list.add(std::move(element));
+    }
+    return static_cast<std::size_t>(header.count);
+}
+
+template <typename List>
+std::size_t readSnapshot(std::istream &is, List &list) {
+    using T = typename List::value_type;
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        // RAW 快照用不到解码器，平凡可复制的类型不要求特化 SnapshotCodec
+        struct __NoCodec {
+            T decode(std::istream &) const {
+                throw std::runtime_error{"no codec for encoded snapshot"};
+            }
+        };
+        return readSnapshot(is, list, __NoCodec{});
+    } else {
+        return readSnapshot(is, list, SnapshotCodec<T>{});
+    }
+}
+
+} // namespace snapshot
+
+} // namespace dsa
+
+#endif
@@ -2,7 +2,7 @@
  * @Author       : sphc
  * @Date         : 2023-11-07 12:02:27
  * @LastEditors  : sphc
- * @LastEditTime : 2023-11-14 12:02:49
+ * @LastEditTime : 2026-10-19 22:26:40
  * @FilePath     : /include/sort.hpp
  * @Description  :
  */
@@ -11,7 +11,10 @@
 
 #include "heap_operation.hpp"
 #include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -20,14 +23,6 @@ namespace dsa {
 
 namespace __detail {
 
-template <typename ElementType>
-void __buildHeap(std::vector<ElementType> &elements) {
-    decltype(elements.size()) end{elements.size() / 2};
-    while (0 < end) {
-        reshapeDown(elements, --end, elements.size() - 1);
-    }
-}
-
 /**
  * @description: 一次冒泡，将最大的元素冒泡到序列的末端，若序列中的元素已经有序，则返回 false
  * @return      {bool} 存在元素交换则返回 true，否则返回 false
@@ -70,20 +65,27 @@ void __selectMaxToEnd(RandomAccessIterator begin, RandomAccessIterator end) {
 } // namespace __detail
 
 /**
- * @description: 堆排序，要求 ElementType 能够支持关系运算和赋值运算
+ * @description: 堆排序，要求元素能够支持关系运算和赋值运算。Arity 为所用堆的子节点数，排序结果按 comp 升序
  * @return      {void}
  */
-// TODO: 改为迭代器形式
-template <typename ElementType>
-void heapSort(std::vector<ElementType> &elements) {
-    __detail::__buildHeap(elements);
-    decltype(elements.size()) end{elements.size()};
-    while (1 < end) {
-        std::swap(elements[0], elements[--end]);
-        reshapeDown(elements, 0, end - 1);
+template <std::size_t Arity = 2, typename RandomAccessIterator,
+          typename Compare = std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>>
+void heapSort(RandomAccessIterator begin, RandomAccessIterator end, Compare comp = Compare{}) {
+    __detail::__buildHeap<Arity>(begin, end, comp);
+    auto size{static_cast<std::size_t>(end - begin)};
+    while (1 < size) {
+        // 堆顶移到末尾，原末尾元素从堆顶的空位自底向上放回堆中
+        typename std::iterator_traits<RandomAccessIterator>::value_type value(std::move(begin[--size]));
+        begin[size] = std::move(begin[0]);
+        __detail::__reshapeDownBottomUp<Arity>(begin, 0, size - 1, std::move(value), comp);
     }
 }
 
+template <std::size_t Arity = 2, typename ElementType, typename Compare = std::less<ElementType>>
+void heapSort(std::vector<ElementType> &elements, Compare comp = Compare{}) {
+    heapSort<Arity>(elements.begin(), elements.end(), comp);
+}
+
 /**
  * @description: 冒泡排序，要求 ElementType 支持关系运算和赋值运算
  * @return      {void}
@@ -0,0 +1,93 @@
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 13:12:36
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 13:12:36
+ * @FilePath     : /include/thread_pool.hpp
+ * @Description  : 工作窃取线程池，每个工作线程拥有自己的任务队列，从队尾取自己的任务，空闲时从其它队列的队头窃取
+ */
+namespace dsa {
+
+class ThreadPool {
+public:
+    using size_type = std::size_t;
+    using Task = std::function<void()>;
+
+    /**
+     * @description: 创建线程池
+     * @param       {size_type} threadCount 工作线程数，为 0 时使用 std::thread::hardware_concurrency()
+     */
+    explicit ThreadPool(size_type threadCount = 0);
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    /**
+     * @description: 等待已提交的任务全部执行完毕后结束所有工作线程
+     */
+    ~ThreadPool();
+
+    [[nodiscard]] size_type threadCount() const noexcept;
+
+    /**
+     * @description: 提交任务，在工作线程中提交时放入该线程自己的队列，否则轮流放入各队列
+     * @param       {Task} task 任务，抛出的异常会被丢弃，需要异常时由调用方自行捕获
+     * @return      {void}
+     */
+    void submit(Task task);
+
+    /**
+     * @description: 将 [0, size) 按 chunkSize 切分后由调用线程和工作线程共同执行，返回前所有分块均已执行完毕。
+     *               调用线程等待期间会帮忙执行队列中的任务，因此可以在任务内部嵌套调用
+     * @param       {size_type} size 区间长度
+     * @param       {size_type} chunkSize 每块的长度，必须大于 0
+     * @param       {const std::function<void(size_type, size_type)> &} body 处理 [begin, end) 的函数
+     * @return      {void} 任一分块抛出异常时，尚未开始的分块不再执行，第一个异常在调用线程中重新抛出
+     */
+    void parallelFor(size_type size, size_type chunkSize, const std::function<void(size_type, size_type)> &body);
+
+    /**
+     * @description: 进程内共享的线程池，首次使用时按 CPU 核数创建
+     * @return      {ThreadPool &} 共享线程池
+     */
+    static ThreadPool &global();
+
+private:
+    struct __Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<__Worker>> __workers;
+    std::vector<std::thread> __threads;
+    std::mutex __sleepMutex;
+    std::condition_variable __wakeup;
+    std::atomic<size_type> __pending;
+    std::atomic<size_type> __nextQueue;
+    bool __stopping;
+
+    void __run(size_type self);
+    /**
+     * @description: 取出一个任务，先取 self 队列的队尾，再从其它队列的队头窃取
+     * @param       {size_type} self 当前工作线程编号，非工作线程传入 threadCount()
+     * @param       {Task &} task 取出的任务
+     * @return      {bool} 取到任务返回 true
+     */
+    bool __tryPop(size_type self, Task &task);
+    size_type __currentWorker() const noexcept;
+};
+
+} // namespace dsa
+
+#endif
@@ -2,16 +2,548 @@
  * @Author       : sphc
  * @Date         : 2023-11-07 12:10:44
  * @LastEditors  : sphc
- * @LastEditTime : 2023-11-08 22:04:29
+ * @LastEditTime : 2026-10-21 11:41:29
  * @FilePath     : /include/utility.hpp
  * @Description  :
  */
 #ifndef __UTILITY_H__
 #define __UTILITY_H__
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
 #include <utility>
 
+#if __cplusplus > 201703L && __has_include(<span>)
+#include <span>
+#endif
+
 namespace dsa {
 
+/**
+ * @description: 判断类型能否被“平凡重定位”：用 memcpy/memmove 搬移对象表示后，原位置无需再析构。
+ *               默认等价于 std::is_trivially_copyable，std::unique_ptr 之类满足该语义的类型可自行特化为 true
+ */
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v{is_trivially_relocatable<T>::value};
+
+namespace __detail {
+
+template <typename Allocator, typename = void>
+struct __hasConstruct : std::false_type {};
+
+template <typename Allocator>
+struct __hasConstruct<Allocator, std::void_t<decltype(std::declval<Allocator &>().construct(std::declval<typename Allocator::value_type *>(), std::declval<typename Allocator::value_type &&>()))>> : std::true_type {};
+
+template <typename Allocator, typename = void>
+struct __hasDestroy : std::false_type {};
+
+template <typename Allocator>
+struct __hasDestroy<Allocator, std::void_t<decltype(std::declval<Allocator &>().destroy(std::declval<typename Allocator::value_type *>()))>> : std::true_type {};
+
+template <typename Allocator>
+struct __hasConstructOrDestroy : std::disjunction<__hasConstruct<Allocator>, __hasDestroy<Allocator>> {};
+
+} // namespace __detail
+
+/**
+ * @description: 判断分配器的 construct/destroy 是否等价于 placement new 和直接析构，
+ *               只有这种情况下容器才能绕过分配器按字节搬移元素
+ */
+template <typename Allocator>
+struct allocator_has_trivial_construct : std::negation<__detail::__hasConstructOrDestroy<Allocator>> {};
+
+template <typename T>
+struct allocator_has_trivial_construct<std::allocator<T>> : std::true_type {};
+
+template <typename T>
+struct allocator_has_trivial_construct<std::pmr::polymorphic_allocator<T>> : std::negation<std::uses_allocator<T, std::pmr::polymorphic_allocator<T>>> {};
+
+template <typename Allocator>
+inline constexpr bool allocator_has_trivial_construct_v{allocator_has_trivial_construct<Allocator>::value};
+
+/*
+ * @Description  : 单调增长的内存池（arena）。分配时只移动指针，deallocate 不做任何事，
+ *                 release() 或析构时一次性把所有内存块还给上游，适合生命周期一致的一批对象（如一次请求内的集合）
+ */
+class MonotonicArena final : public std::pmr::memory_resource {
+public:
+    explicit MonotonicArena(std::size_t initialBlockSize = __DEFAULT_BLOCK_SIZE, std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()) :
+        __upstream{upstream}, __initialBlockSize{std::max(initialBlockSize, __MIN_BLOCK_SIZE)}, __nextBlockSize{__initialBlockSize} {
+    }
+    MonotonicArena(const MonotonicArena &) = delete;
+    MonotonicArena &operator=(const MonotonicArena &) = delete;
+    ~MonotonicArena() override {
+        release();
+    }
+
+    /**
+     * @description: 释放 arena 中的所有内存，之前分配出去的内存全部失效；之后的块大小从初始值重新开始增长
+     * @return      {void}
+     */
+    void release() noexcept {
+        while (__blocks != nullptr) {
+            __BlockHeader *next{__blocks->next};
+            __upstream->deallocate(__blocks, __blocks->size, alignof(std::max_align_t));
+            __blocks = next;
+        }
+        __cur = __end = nullptr;
+        __nextBlockSize = __initialBlockSize;
+        __bytesAllocated = 0;
+    }
+
+    /**
+     * @description: 获取已经分配出去的字节数（包含对齐填充）
+     * @return      {std::size_t} 已分配的字节数
+     */
+    [[nodiscard]] std::size_t bytesAllocated() const noexcept {
+        return __bytesAllocated;
+    }
+
+protected:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        void *result{__tryAllocate(bytes, alignment)};
+        if (result == nullptr) {
+            __newBlock(bytes + alignment);
+            result = __tryAllocate(bytes, alignment);
+        }
+        return result;
+    }
+
+    void do_deallocate(void *, std::size_t, std::size_t) override {
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    struct alignas(std::max_align_t) __BlockHeader {
+        __BlockHeader *next;
+        std::size_t size;
+    };
+
+    inline static constexpr std::size_t __DEFAULT_BLOCK_SIZE{4096};
+    inline static constexpr std::size_t __MIN_BLOCK_SIZE{sizeof(__BlockHeader) * 4};
+
+    std::pmr::memory_resource *__upstream;
+    __BlockHeader *__blocks{nullptr};
+    char *__cur{nullptr};
+    char *__end{nullptr};
+    const std::size_t __initialBlockSize;
+    std::size_t __nextBlockSize;
+    std::size_t __bytesAllocated{0};
+
+    void *__tryAllocate(std::size_t bytes, std::size_t alignment) noexcept {
+        void *ptr{__cur};
+        std::size_t space{static_cast<std::size_t>(__end - __cur)};
+        if (__cur == nullptr || std::align(alignment, bytes, ptr, space) == nullptr) {
+            return nullptr;
+        }
+        char *next{static_cast<char *>(ptr) + bytes};
+        __bytesAllocated += next - __cur;
+        __cur = next;
+        return ptr;
+    }
+
+    void __newBlock(std::size_t minBytes) {
+        // 块大小按几何级数增长，块的数量保持在对数级别
+        std::size_t blockSize{std::max(__nextBlockSize, minBytes + sizeof(__BlockHeader))};
+        auto block{static_cast<__BlockHeader *>(__upstream->allocate(blockSize, alignof(std::max_align_t)))};
+        block->next = __blocks;
+        block->size = blockSize;
+        __blocks = block;
+        __cur = reinterpret_cast<char *>(block + 1);
+        __end = reinterpret_cast<char *>(block) + blockSize;
+        __nextBlockSize = blockSize << 1;
+    }
+};
+
+/*
+ * @Description  : 按大小分级的内存池。每个 2 的幂大小级别维护一条空闲链表，deallocate 把内存块挂回链表，
+ *                 空闲链表为空时才向上游批量申请；超过 MAX_POOLED_SIZE 或对齐要求超过 max_align_t 的请求直接转发给上游
+ */
+class SizeClassPool final : public std::pmr::memory_resource {
+public:
+    inline static constexpr std::size_t MIN_POOLED_SIZE{sizeof(void *)};
+    inline static constexpr std::size_t MAX_POOLED_SIZE{4096};
+
+    explicit SizeClassPool(std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()) :
+        __upstream{upstream} {
+    }
+    SizeClassPool(const SizeClassPool &) = delete;
+    SizeClassPool &operator=(const SizeClassPool &) = delete;
+    ~SizeClassPool() override {
+        release();
+    }
+
+    /**
+     * @description: 释放池中的所有内存，之前分配出去的内存全部失效
+     * @return      {void}
+     */
+    void release() noexcept {
+        while (__chunks != nullptr) {
+            __ChunkHeader *next{__chunks->next};
+            __upstream->deallocate(__chunks, __chunks->size, alignof(std::max_align_t));
+            __chunks = next;
+        }
+        std::fill(std::begin(__freeLists), std::end(__freeLists), nullptr);
+    }
+
+protected:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        if (!__isPooled(bytes, alignment)) {
+            return __upstream->allocate(bytes, alignment);
+        }
+        std::size_t sizeClass{__sizeClassOf(bytes, alignment)};
+        if (__freeLists[sizeClass] == nullptr) {
+            __refill(sizeClass);
+        }
+        __FreeBlock *block{__freeLists[sizeClass]};
+        __freeLists[sizeClass] = block->next;
+        return block;
+    }
+
+    void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override {
+        if (!__isPooled(bytes, alignment)) {
+            __upstream->deallocate(ptr, bytes, alignment);
+            return;
+        }
+        std::size_t sizeClass{__sizeClassOf(bytes, alignment)};
+        __freeLists[sizeClass] = ::new (ptr) __FreeBlock{__freeLists[sizeClass]};
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    struct __FreeBlock {
+        __FreeBlock *next;
+    };
+    struct alignas(std::max_align_t) __ChunkHeader {
+        __ChunkHeader *next;
+        std::size_t size;
+    };
+
+    inline static constexpr std::size_t __CHUNK_SIZE{64 * 1024};
+    inline static constexpr std::size_t __SIZE_CLASS_COUNT{10}; // 8, 16, ..., 4096
+
+    std::pmr::memory_resource *__upstream;
+    __ChunkHeader *__chunks{nullptr};
+    __FreeBlock *__freeLists[__SIZE_CLASS_COUNT]{};
+
+    static bool __isPooled(std::size_t bytes, std::size_t alignment) noexcept {
+        return bytes <= MAX_POOLED_SIZE && alignment <= alignof(std::max_align_t);
+    }
+
+    static std::size_t __sizeClassOf(std::size_t bytes, std::size_t alignment) noexcept {
+        std::size_t size{std::max({bytes, alignment, MIN_POOLED_SIZE})};
+        std::size_t sizeClass{0};
+        while ((MIN_POOLED_SIZE << sizeClass) < size) {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    void __refill(std::size_t sizeClass) {
+        std::size_t blockSize{MIN_POOLED_SIZE << sizeClass};
+        auto chunk{static_cast<__ChunkHeader *>(__upstream->allocate(__CHUNK_SIZE, alignof(std::max_align_t)))};
+        chunk->next = __chunks;
+        chunk->size = __CHUNK_SIZE;
+        __chunks = chunk;
+        char *first{reinterpret_cast<char *>(chunk + 1)};
+        char *last{reinterpret_cast<char *>(chunk) + __CHUNK_SIZE};
+        for (char *block{first}; block + blockSize <= last; block += blockSize) {
+            __freeLists[sizeClass] = ::new (block) __FreeBlock{__freeLists[sizeClass]};
+        }
+    }
+};
+
+/*
+ * @Description  : 绑定到具体内存资源类型的分配器。与 std::pmr::polymorphic_allocator 不同，
+ *                 资源类型在编译期确定，分配调用可以被内联
+ */
+template <typename T, typename Resource>
+class ResourceAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template <typename U>
+    struct rebind {
+        using other = ResourceAllocator<U, Resource>;
+    };
+
+    ResourceAllocator(Resource *resource) noexcept :
+        __resource{resource} {
+    }
+    ResourceAllocator(Resource &resource) noexcept :
+        __resource{&resource} {
+    }
+    template <typename U>
+    ResourceAllocator(const ResourceAllocator<U, Resource> &rhs) noexcept :
+        __resource{rhs.resource()} {
+    }
+
+    [[nodiscard]] T *allocate(std::size_t n) {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length{};
+        }
+        return static_cast<T *>(__resource->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *ptr, std::size_t n) noexcept {
+        __resource->deallocate(ptr, n * sizeof(T), alignof(T));
+    }
+
+    [[nodiscard]] Resource *resource() const noexcept {
+        return __resource;
+    }
+
+    template <typename U>
+    bool operator==(const ResourceAllocator<U, Resource> &rhs) const noexcept {
+        return __resource == rhs.resource();
+    }
+
+    template <typename U>
+    bool operator!=(const ResourceAllocator<U, Resource> &rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+private:
+    Resource *__resource;
+};
+
+/*
+ * @Description  : 连续内存容器的随机访问迭代器。Container 只用于区分不同容器的迭代器类型，
+ *                 T 为 const 类型时即为 const 迭代器，非 const 迭代器可以隐式转换为 const 迭代器
+ */
+template <typename T, typename Container>
+class ContiguousIterator {
+public:
+    // iterator traits
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::remove_cv_t<T>;
+    using pointer = T *;
+    using reference = T &;
+    using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus > 201703L
+    using iterator_concept = std::contiguous_iterator_tag;
+    using element_type = T;
+#endif
+
+    constexpr ContiguousIterator() noexcept :
+        __cur{nullptr} {
+    }
+    constexpr explicit ContiguousIterator(pointer pos) noexcept :
+        __cur{pos} {
+    }
+    template <typename U, typename = std::enable_if_t<std::is_same_v<const U, T>>>
+    constexpr ContiguousIterator(const ContiguousIterator<U, Container> &rhs) noexcept :
+        __cur{rhs.base()} {
+    }
+
+    constexpr reference operator*() const noexcept {
+        return *__cur;
+    }
+
+    constexpr pointer operator->() const noexcept {
+        return __cur;
+    }
+
+    constexpr reference operator[](difference_type step) const noexcept {
+        return __cur[step];
+    }
+
+    constexpr ContiguousIterator &operator++() noexcept {
+        ++__cur;
+        return *this;
+    }
+
+    constexpr ContiguousIterator &operator--() noexcept {
+        --__cur;
+        return *this;
+    }
+
+    constexpr ContiguousIterator operator++(int) noexcept {
+        return ContiguousIterator{__cur++};
+    }
+
+    constexpr ContiguousIterator operator--(int) noexcept {
+        return ContiguousIterator{__cur--};
+    }
+
+    constexpr ContiguousIterator &operator+=(difference_type step) noexcept {
+        __cur += step;
+        return *this;
+    }
+
+    constexpr ContiguousIterator &operator-=(difference_type step) noexcept {
+        __cur -= step;
+        return *this;
+    }
+
+    constexpr ContiguousIterator operator+(difference_type step) const noexcept {
+        return ContiguousIterator{__cur + step};
+    }
+
+    friend constexpr ContiguousIterator operator+(difference_type step, ContiguousIterator it) noexcept {
+        return it + step;
+    }
+
+    constexpr ContiguousIterator operator-(difference_type step) const noexcept {
+        return ContiguousIterator{__cur - step};
+    }
+
+    template <typename U>
+    constexpr difference_type operator-(const ContiguousIterator<U, Container> &rhs) const noexcept {
+        return __cur - rhs.base();
+    }
+
+    template <typename U>
+    constexpr bool operator==(const ContiguousIterator<U, Container> &rhs) const noexcept {
+        return __cur == rhs.base();
+    }
+
+    template <typename U>
+    constexpr bool operator!=(const ContiguousIterator<U, Container> &rhs) const noexcept {
+        return __cur != rhs.base();
+    }
+
+    template <typename U>
+    constexpr bool operator<(const ContiguousIterator<U, Container> &rhs) const noexcept {
+        return __cur < rhs.base();
+    }
+
+    template <typename U>
+    constexpr bool operator>(const ContiguousIterator<U, Container> &rhs) const noexcept {
+        return __cur > rhs.base();
+    }
+
+    template <typename U>
+    constexpr bool operator<=(const ContiguousIterator<U, Container> &rhs) const noexcept {
+        return __cur <= rhs.base();
+    }
+
+    template <typename U>
+    constexpr bool operator>=(const ContiguousIterator<U, Container> &rhs) const noexcept {
+        return __cur >= rhs.base();
+    }
+
+    /**
+     * @description: 获取迭代器指向的原始指针
+     * @return      {pointer} 原始指针
+     */
+    constexpr pointer base() const noexcept {
+        return __cur;
+    }
+
+private:
+    pointer __cur;
+};
+
+/*
+ * @Description  : 连续内存的非拥有视图，相当于 C++17 下的 std::span<T>；C++20 下可以隐式转换为 std::span<T>
+ */
+template <typename T>
+class Span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+    using iterator = T *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    constexpr Span() noexcept :
+        __data{nullptr}, __size{0} {
+    }
+    constexpr Span(pointer data, size_type size) noexcept :
+        __data{data}, __size{size} {
+    }
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr Span(const Span<U> &rhs) noexcept :
+        __data{rhs.data()}, __size{rhs.size()} {
+    }
+
+    [[nodiscard]] constexpr pointer data() const noexcept {
+        return __data;
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return __size;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return __size == 0;
+    }
+
+    constexpr reference operator[](size_type index) const noexcept {
+        return __data[index];
+    }
+
+    constexpr iterator begin() const noexcept {
+        return __data;
+    }
+
+    constexpr iterator end() const noexcept {
+        return __data + __size;
+    }
+
+    constexpr reverse_iterator rbegin() const noexcept {
+        return reverse_iterator{end()};
+    }
+
+    constexpr reverse_iterator rend() const noexcept {
+        return reverse_iterator{begin()};
+    }
+
+    constexpr Span first(size_type count) const noexcept {
+        return Span{__data, count};
+    }
+
+    constexpr Span last(size_type count) const noexcept {
+        return Span{__data + __size - count, count};
+    }
+
+    /**
+     * @description: 获取从 offset 开始、长度为 count 的子视图，count 超出范围时截断到末尾
+     * @return      {Span} 子视图
+     */
+    constexpr Span subspan(size_type offset, size_type count = std::numeric_limits<size_type>::max()) const noexcept {
+        return Span{__data + offset, std::min(count, __size - offset)};
+    }
+
+#if __cplusplus > 201703L && __has_include(<span>)
+    constexpr operator std::span<T>() const noexcept {
+        return std::span<T>{__data, __size};
+    }
+#endif
+
+private:
+    pointer __data;
+    size_type __size;
+};
+
+template <typename T>
+using ArenaAllocator = ResourceAllocator<T, MonotonicArena>;
+
+template <typename T>
+using PoolAllocator = ResourceAllocator<T, SizeClassPool>;
+
 } // namespace dsa
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,72 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 16:30:12
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 16:30:12
+ * @FilePath     : /src/array_list_stats.cpp
+ * @Description  :
+ */
+#include "ArrayListStats.hpp"
+#include <atomic>
+
+namespace dsa {
+
+namespace {
+
+struct __GlobalStats {
+    std::atomic<std::size_t> growCount{0};
+    std::atomic<std::size_t> shrinkCount{0};
+    std::atomic<std::size_t> bytesAllocated{0};
+    std::atomic<std::size_t> elementsMoved{0};
+    std::atomic<std::size_t> peakCapacity{0};
+};
+
+__GlobalStats __globalStats{};
+
+} // namespace
+
+ArrayListStats globalArrayListStats() noexcept {
+    ArrayListStats stats{};
+    stats.growCount = __globalStats.growCount.load(std::memory_order_relaxed);
+    stats.shrinkCount = __globalStats.shrinkCount.load(std::memory_order_relaxed);
+    stats.bytesAllocated = __globalStats.bytesAllocated.load(std::memory_order_relaxed);
+    stats.elementsMoved = __globalStats.elementsMoved.load(std::memory_order_relaxed);
+    stats.peakCapacity = __globalStats.peakCapacity.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void resetGlobalArrayListStats() noexcept {
+    __globalStats.growCount.store(0, std::memory_order_relaxed);
+    __globalStats.shrinkCount.store(0, std::memory_order_relaxed);
+    __globalStats.bytesAllocated.store(0, std::memory_order_relaxed);
+    __globalStats.elementsMoved.store(0, std::memory_order_relaxed);
+    __globalStats.peakCapacity.store(0, std::memory_order_relaxed);
+}
+
+namespace __detail {
+
+void __recordArrayListRealloc(std::size_t oldCapacity, std::size_t newCapacity, std::size_t elementSize, std::size_t moved, ArrayListStats &stats) noexcept {
+    if (oldCapacity != 0) {
+        if (newCapacity > oldCapacity) {
+            ++stats.growCount;
+            __globalStats.growCount.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            ++stats.shrinkCount;
+            __globalStats.shrinkCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    stats.bytesAllocated += newCapacity * elementSize;
+    __globalStats.bytesAllocated.fetch_add(newCapacity * elementSize, std::memory_order_relaxed);
+    stats.elementsMoved += moved;
+    __globalStats.elementsMoved.fetch_add(moved, std::memory_order_relaxed);
+    if (newCapacity > stats.peakCapacity) {
+        stats.peakCapacity = newCapacity;
+        std::size_t peak{__globalStats.peakCapacity.load(std::memory_order_relaxed)};
+        while (newCapacity > peak && !__globalStats.peakCapacity.compare_exchange_weak(peak, newCapacity, std::memory_order_relaxed)) {
+        }
+    }
+}
+
+} // namespace __detail
+
+} // namespace dsa
@@ -0,0 +1,27 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 23:14:26
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-20 10:05:12
+ * @FilePath     : /src/list_index_checker.cpp
+ * @Description  :
+ */
+#include "ListIndexChecker.hpp"
+#include <sstream>
+#include <stdexcept>
+
+namespace dsa {
+
+void ListIndexChecker::__throwOutOfRangeException(_OperationName operation, size_type operatePos, size_type size) {
+    std::ostringstream sstream{};
+    sstream << "operation: " << operation << " [size of list: " << size << ", try to operate at pos: " << operatePos << "].";
+    throw std::out_of_range(sstream.str());
+}
+
+void ListIndexChecker::__throwOutOfRangeException(_OperationName operation, size_type from, size_type to, size_type size) {
+    std::ostringstream sstream{};
+    sstream << "operation: " << operation << " [size of list: " << size << ", try to operate at range: [" << from << ", " << to << ")].";
+    throw std::out_of_range(sstream.str());
+}
+
+} // namespace dsa
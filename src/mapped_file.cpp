@@ -0,0 +1,133 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 21:20:48
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 21:20:48
+ * @FilePath     : /src/mapped_file.cpp
+ * @Description  :
+ */
+#include "mapped_file.hpp"
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+namespace dsa {
+
+namespace {
+
+[[noreturn]] void __throwSystemError(const std::string &operation, const std::string &path = "") {
+    throw std::system_error{errno, std::generic_category(), path.empty() ? operation : operation + " " + path};
+}
+
+} // namespace
+
+MappedFile::MappedFile(const std::string &path, std::size_t initialSize) :
+    __fd{-1}, __data{nullptr}, __size{0}, __created{false} {
+    __fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (__fd == -1) {
+        __throwSystemError("open", path);
+    }
+    try {
+        struct stat status {};
+        if (::fstat(__fd, &status) == -1) {
+            __throwSystemError("fstat", path);
+        }
+        __size = static_cast<std::size_t>(status.st_size);
+        if (__size == 0) {
+            if (::ftruncate(__fd, static_cast<off_t>(initialSize)) == -1) {
+                __throwSystemError("ftruncate", path);
+            }
+            __size = initialSize;
+            __created = true;
+        }
+        __data = ::mmap(nullptr, __size, PROT_READ | PROT_WRITE, MAP_SHARED, __fd, 0);
+        if (__data == MAP_FAILED) {
+            __data = nullptr;
+            __throwSystemError("mmap", path);
+        }
+    } catch (...) {
+        __close();
+        throw;
+    }
+}
+
+MappedFile::MappedFile(MappedFile &&rhs) noexcept :
+    __fd{std::exchange(rhs.__fd, -1)}, __data{std::exchange(rhs.__data, nullptr)}, __size{std::exchange(rhs.__size, 0)}, __created{rhs.__created} {
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&rhs) noexcept {
+    if (this != &rhs) {
+        __close();
+        __fd = std::exchange(rhs.__fd, -1);
+        __data = std::exchange(rhs.__data, nullptr);
+        __size = std::exchange(rhs.__size, 0);
+        __created = rhs.__created;
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    __close();
+}
+
+[[nodiscard]] void *MappedFile::data() const noexcept {
+    return __data;
+}
+
+[[nodiscard]] std::size_t MappedFile::size() const noexcept {
+    return __size;
+}
+
+[[nodiscard]] bool MappedFile::created() const noexcept {
+    return __created;
+}
+
+void MappedFile::resize(std::size_t newSize) {
+    if (newSize == __size) {
+        return;
+    }
+    // 先扩大文件再扩大映射；缩小时先缩小映射，避免映射覆盖文件末尾之外的页
+    if (newSize > __size && ::ftruncate(__fd, static_cast<off_t>(newSize)) == -1) {
+        __throwSystemError("ftruncate");
+    }
+#ifdef __linux__
+    void *newData{::mremap(__data, __size, newSize, MREMAP_MAYMOVE)};
+#else
+    void *newData{::mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, __fd, 0)};
+    if (newData != MAP_FAILED) {
+        ::munmap(__data, __size);
+    }
+#endif
+    if (newData == MAP_FAILED) {
+        __throwSystemError("mremap");
+    }
+    __data = newData;
+    if (newSize < __size && ::ftruncate(__fd, static_cast<off_t>(newSize)) == -1) {
+        __size = newSize;
+        __throwSystemError("ftruncate");
+    }
+    __size = newSize;
+}
+
+void MappedFile::sync(bool async) {
+    if (::msync(__data, __size, async ? MS_ASYNC : MS_SYNC) == -1) {
+        __throwSystemError("msync");
+    }
+}
+
+void MappedFile::__close() noexcept {
+    if (__data != nullptr) {
+        ::munmap(__data, __size);
+        __data = nullptr;
+    }
+    if (__fd != -1) {
+        ::close(__fd);
+        __fd = -1;
+    }
+}
+
+} // namespace dsa
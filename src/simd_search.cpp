@@ -0,0 +1,365 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 15:42:10
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 15:42:10
+ * @FilePath     : /src/simd_search.cpp
+ * @Description  :
+ */
+#include "simd_search.hpp"
+#include <atomic>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define __DSA_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace dsa {
+
+namespace simd {
+
+namespace {
+
+std::atomic<InstructionSet> __currentInstructionSet{detectInstructionSet()};
+
+template <typename Lane>
+Lane __loadLane(const unsigned char *p) noexcept {
+    Lane lane;
+    std::memcpy(&lane, p, sizeof(Lane));
+    return lane;
+}
+
+template <typename Lane>
+std::size_t __findFirstScalar(const unsigned char *data, std::size_t first, std::size_t size, Lane value) noexcept {
+    for (; first < size; ++first) {
+        if (__loadLane<Lane>(data + first * sizeof(Lane)) == value) {
+            return first;
+        }
+    }
+    return size;
+}
+
+/**
+ * @description: 在 [0, last) 中从后往前查找
+ * @return      {std::size_t} 找到返回下标，否则返回 size
+ */
+template <typename Lane>
+std::size_t __findLastScalar(const unsigned char *data, std::size_t last, std::size_t size, Lane value) noexcept {
+    while (last > 0) {
+        if (__loadLane<Lane>(data + --last * sizeof(Lane)) == value) {
+            return last;
+        }
+    }
+    return size;
+}
+
+template <typename Lane>
+std::size_t __countScalar(const unsigned char *data, std::size_t first, std::size_t size, Lane value) noexcept {
+    std::size_t result{0};
+    for (; first < size; ++first) {
+        result += __loadLane<Lane>(data + first * sizeof(Lane)) == value;
+    }
+    return result;
+}
+
+#ifdef __DSA_SIMD_X86
+
+/*
+ * 每种指令集提供 mask()：比较一个向量宽度的元素，返回逐字节的比较结果（相等的元素对应 sizeof(Lane) 个 1 位），
+ * 这样不论元素宽度，下标都可以由 ctz(mask) / sizeof(Lane) 得到
+ */
+struct __Sse2 {
+    inline static constexpr std::size_t BYTES{16};
+
+    template <typename Lane>
+    static unsigned mask(const unsigned char *p, Lane value) noexcept {
+        if constexpr (std::is_same_v<Lane, float>) {
+            return _mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(reinterpret_cast<const float *>(p)), _mm_set1_ps(value))));
+        } else if constexpr (std::is_same_v<Lane, double>) {
+            return _mm_movemask_epi8(_mm_castpd_si128(_mm_cmpeq_pd(_mm_loadu_pd(reinterpret_cast<const double *>(p)), _mm_set1_pd(value))));
+        } else {
+            __m128i v{_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))};
+            if constexpr (sizeof(Lane) == 1) {
+                return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(value))));
+            } else if constexpr (sizeof(Lane) == 2) {
+                return _mm_movemask_epi8(_mm_cmpeq_epi16(v, _mm_set1_epi16(static_cast<short>(value))));
+            } else if constexpr (sizeof(Lane) == 4) {
+                return _mm_movemask_epi8(_mm_cmpeq_epi32(v, _mm_set1_epi32(static_cast<int>(value))));
+            } else {
+                // SSE2 没有 64 位整数比较，两个 32 位半部分都相等才算相等
+                __m128i eq{_mm_cmpeq_epi32(v, _mm_set1_epi64x(static_cast<long long>(value)))};
+                return _mm_movemask_epi8(_mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1))));
+            }
+        }
+    }
+};
+
+struct __Avx2 {
+    inline static constexpr std::size_t BYTES{32};
+
+    template <typename Lane>
+    __attribute__((target("avx2"))) static unsigned mask(const unsigned char *p, Lane value) noexcept {
+        if constexpr (std::is_same_v<Lane, float>) {
+            return _mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps(reinterpret_cast<const float *>(p)), _mm256_set1_ps(value), _CMP_EQ_OQ)));
+        } else if constexpr (std::is_same_v<Lane, double>) {
+            return _mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(reinterpret_cast<const double *>(p)), _mm256_set1_pd(value), _CMP_EQ_OQ)));
+        } else {
+            __m256i v{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p))};
+            if constexpr (sizeof(Lane) == 1) {
+                return _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(static_cast<char>(value))));
+            } else if constexpr (sizeof(Lane) == 2) {
+                return _mm256_movemask_epi8(_mm256_cmpeq_epi16(v, _mm256_set1_epi16(static_cast<short>(value))));
+            } else if constexpr (sizeof(Lane) == 4) {
+                return _mm256_movemask_epi8(_mm256_cmpeq_epi32(v, _mm256_set1_epi32(static_cast<int>(value))));
+            } else {
+                return _mm256_movemask_epi8(_mm256_cmpeq_epi64(v, _mm256_set1_epi64x(static_cast<long long>(value))));
+            }
+        }
+    }
+};
+
+// 查找时每步比较的向量个数，8 位元素在 AVX2 下每步比较 128 个，32 位元素每步比较 32 个
+inline constexpr std::size_t __UNROLL{4};
+
+/*
+ * 以下循环模板强制内联到带 target 属性的入口函数中，从而以对应指令集编译
+ */
+template <typename Isa, typename Lane>
+__attribute__((always_inline)) inline std::size_t __findFirstVector(const unsigned char *data, std::size_t size, Lane value) noexcept {
+    constexpr std::size_t LANES{Isa::BYTES / sizeof(Lane)};
+    std::size_t i{0};
+    for (; i + LANES * __UNROLL <= size; i += LANES * __UNROLL) {
+        unsigned masks[__UNROLL];
+        unsigned any{0};
+        for (std::size_t k{0}; k < __UNROLL; ++k) {
+            masks[k] = Isa::mask(data + (i + k * LANES) * sizeof(Lane), value);
+            any |= masks[k];
+        }
+        if (any != 0) {
+            for (std::size_t k{0}; k < __UNROLL; ++k) {
+                if (masks[k] != 0) {
+                    return i + k * LANES + __builtin_ctz(masks[k]) / sizeof(Lane);
+                }
+            }
+        }
+    }
+    for (; i + LANES <= size; i += LANES) {
+        unsigned mask{Isa::mask(data + i * sizeof(Lane), value)};
+        if (mask != 0) {
+            return i + __builtin_ctz(mask) / sizeof(Lane);
+        }
+    }
+    return __findFirstScalar(data, i, size, value);
+}
+
+template <typename Isa, typename Lane>
+__attribute__((always_inline)) inline std::size_t __findLastVector(const unsigned char *data, std::size_t size, Lane value) noexcept {
+    constexpr std::size_t LANES{Isa::BYTES / sizeof(Lane)};
+    std::size_t i{size};
+    while (i >= LANES) {
+        i -= LANES;
+        unsigned mask{Isa::mask(data + i * sizeof(Lane), value)};
+        if (mask != 0) {
+            return i + (31 - __builtin_clz(mask)) / sizeof(Lane);
+        }
+    }
+    return __findLastScalar(data, i, size, value);
+}
+
+template <typename Isa, typename Lane>
+__attribute__((always_inline)) inline std::size_t __countVector(const unsigned char *data, std::size_t size, Lane value) noexcept {
+    constexpr std::size_t LANES{Isa::BYTES / sizeof(Lane)};
+    std::size_t bits{0};
+    std::size_t i{0};
+    for (; i + LANES <= size; i += LANES) {
+        bits += __builtin_popcount(Isa::mask(data + i * sizeof(Lane), value));
+    }
+    return bits / sizeof(Lane) + __countScalar(data, i, size, value);
+}
+
+template <typename Lane>
+std::size_t __findFirstSse2(const unsigned char *data, std::size_t size, Lane value) noexcept {
+    return __findFirstVector<__Sse2>(data, size, value);
+}
+
+template <typename Lane>
+std::size_t __findLastSse2(const unsigned char *data, std::size_t size, Lane value) noexcept {
+    return __findLastVector<__Sse2>(data, size, value);
+}
+
+template <typename Lane>
+std::size_t __countSse2(const unsigned char *data, std::size_t size, Lane value) noexcept {
+    return __countVector<__Sse2>(data, size, value);
+}
+
+template <typename Lane>
+__attribute__((target("avx2"))) std::size_t __findFirstAvx2(const unsigned char *data, std::size_t size, Lane value) noexcept {
+    return __findFirstVector<__Avx2>(data, size, value);
+}
+
+template <typename Lane>
+__attribute__((target("avx2"))) std::size_t __findLastAvx2(const unsigned char *data, std::size_t size, Lane value) noexcept {
+    return __findLastVector<__Avx2>(data, size, value);
+}
+
+template <typename Lane>
+__attribute__((target("avx2"))) std::size_t __countAvx2(const unsigned char *data, std::size_t size, Lane value) noexcept {
+    return __countVector<__Avx2>(data, size, value);
+}
+
+#endif
+
+template <typename Lane>
+std::size_t __dispatchFindFirst(const void *data, std::size_t size, Lane value) noexcept {
+    auto bytes{static_cast<const unsigned char *>(data)};
+#ifdef __DSA_SIMD_X86
+    switch (getInstructionSet()) {
+    case InstructionSet::AVX2:
+        return __findFirstAvx2(bytes, size, value);
+    case InstructionSet::SSE2:
+        return __findFirstSse2(bytes, size, value);
+    default:
+        break;
+    }
+#endif
+    return __findFirstScalar(bytes, 0, size, value);
+}
+
+template <typename Lane>
+std::size_t __dispatchFindLast(const void *data, std::size_t size, Lane value) noexcept {
+    auto bytes{static_cast<const unsigned char *>(data)};
+#ifdef __DSA_SIMD_X86
+    switch (getInstructionSet()) {
+    case InstructionSet::AVX2:
+        return __findLastAvx2(bytes, size, value);
+    case InstructionSet::SSE2:
+        return __findLastSse2(bytes, size, value);
+    default:
+        break;
+    }
+#endif
+    return __findLastScalar(bytes, size, size, value);
+}
+
+template <typename Lane>
+std::size_t __dispatchCount(const void *data, std::size_t size, Lane value) noexcept {
+    auto bytes{static_cast<const unsigned char *>(data)};
+#ifdef __DSA_SIMD_X86
+    switch (getInstructionSet()) {
+    case InstructionSet::AVX2:
+        return __countAvx2(bytes, size, value);
+    case InstructionSet::SSE2:
+        return __countSse2(bytes, size, value);
+    default:
+        break;
+    }
+#endif
+    return __countScalar(bytes, 0, size, value);
+}
+
+} // namespace
+
+InstructionSet detectInstructionSet() noexcept {
+#ifdef __DSA_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return InstructionSet::AVX2;
+    }
+    return InstructionSet::SSE2;
+#else
+    return InstructionSet::SCALAR;
+#endif
+}
+
+InstructionSet getInstructionSet() noexcept {
+    return __currentInstructionSet.load(std::memory_order_relaxed);
+}
+
+InstructionSet setInstructionSet(InstructionSet instructionSet) noexcept {
+    InstructionSet supported{detectInstructionSet()};
+    if (static_cast<int>(instructionSet) > static_cast<int>(supported)) {
+        instructionSet = supported;
+    }
+    __currentInstructionSet.store(instructionSet, std::memory_order_relaxed);
+    return instructionSet;
+}
+
+namespace __detail {
+
+std::size_t __findFirst(const void *data, std::size_t size, std::uint8_t value) noexcept {
+    return __dispatchFindFirst(data, size, value);
+}
+
+std::size_t __findFirst(const void *data, std::size_t size, std::uint16_t value) noexcept {
+    return __dispatchFindFirst(data, size, value);
+}
+
+std::size_t __findFirst(const void *data, std::size_t size, std::uint32_t value) noexcept {
+    return __dispatchFindFirst(data, size, value);
+}
+
+std::size_t __findFirst(const void *data, std::size_t size, std::uint64_t value) noexcept {
+    return __dispatchFindFirst(data, size, value);
+}
+
+std::size_t __findFirst(const void *data, std::size_t size, float value) noexcept {
+    return __dispatchFindFirst(data, size, value);
+}
+
+std::size_t __findFirst(const void *data, std::size_t size, double value) noexcept {
+    return __dispatchFindFirst(data, size, value);
+}
+
+std::size_t __findLast(const void *data, std::size_t size, std::uint8_t value) noexcept {
+    return __dispatchFindLast(data, size, value);
+}
+
+std::size_t __findLast(const void *data, std::size_t size, std::uint16_t value) noexcept {
+    return __dispatchFindLast(data, size, value);
+}
+
+std::size_t __findLast(const void *data, std::size_t size, std::uint32_t value) noexcept {
+    return __dispatchFindLast(data, size, value);
+}
+
+std::size_t __findLast(const void *data, std::size_t size, std::uint64_t value) noexcept {
+    return __dispatchFindLast(data, size, value);
+}
+
+std::size_t __findLast(const void *data, std::size_t size, float value) noexcept {
+    return __dispatchFindLast(data, size, value);
+}
+
+std::size_t __findLast(const void *data, std::size_t size, double value) noexcept {
+    return __dispatchFindLast(data, size, value);
+}
+
+std::size_t __count(const void *data, std::size_t size, std::uint8_t value) noexcept {
+    return __dispatchCount(data, size, value);
+}
+
+std::size_t __count(const void *data, std::size_t size, std::uint16_t value) noexcept {
+    return __dispatchCount(data, size, value);
+}
+
+std::size_t __count(const void *data, std::size_t size, std::uint32_t value) noexcept {
+    return __dispatchCount(data, size, value);
+}
+
+std::size_t __count(const void *data, std::size_t size, std::uint64_t value) noexcept {
+    return __dispatchCount(data, size, value);
+}
+
+std::size_t __count(const void *data, std::size_t size, float value) noexcept {
+    return __dispatchCount(data, size, value);
+}
+
+std::size_t __count(const void *data, std::size_t size, double value) noexcept {
+    return __dispatchCount(data, size, value);
+}
+
+} // namespace __detail
+
+} // namespace simd
+
+} // namespace dsa
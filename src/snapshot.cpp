@@ -0,0 +1,91 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 22:24:37
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-21 10:26:18
+ * @FilePath     : /src/snapshot.cpp
+ * @Description  :
+ */
+#include "snapshot.hpp"
+#include <cerrno>
+#include <sys/uio.h>
+#include <system_error>
+
+namespace dsa {
+
+namespace snapshot {
+
+namespace __detail {
+
+void __writeRaw(int fd, const SnapshotHeader &header, const void *payload, std::size_t bytes) {
+    iovec vectors[2]{
+        {const_cast<SnapshotHeader *>(&header), sizeof(header)},
+        {const_cast<void *>(payload), bytes}};
+    iovec *cur{vectors};
+    int remaining{bytes == 0 ? 1 : 2};
+    while (remaining > 0) {
+        ssize_t written{::writev(fd, cur, remaining)};
+        if (written == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error{errno, std::generic_category(), "writev"};
+        }
+        // 部分写入时跳过已经写完的部分继续写
+        auto left{static_cast<std::size_t>(written)};
+        while (remaining > 0 && left >= cur->iov_len) {
+            left -= cur->iov_len;
+            ++cur;
+            --remaining;
+        }
+        if (remaining > 0) {
+            cur->iov_base = static_cast<char *>(cur->iov_base) + left;
+            cur->iov_len -= left;
+        }
+    }
+}
+
+void __checkHeader(const SnapshotHeader &header, std::uint32_t expectedFlag, std::uint64_t expectedElementSize) {
+    if (header.magic != MAGIC) {
+        throw std::runtime_error{"not a snapshot"};
+    }
+    if (header.version != VERSION) {
+        throw std::runtime_error{"unsupported snapshot version " + std::to_string(header.version)};
+    }
+    if (header.flags != expectedFlag) {
+        throw std::runtime_error{expectedFlag == FLAG_RAW ? "snapshot is not in raw format" : "snapshot is not in encoded format"};
+    }
+    if (header.elementSize != expectedElementSize) {
+        throw std::runtime_error{"snapshot element size " + std::to_string(header.elementSize) + " does not match " + std::to_string(expectedElementSize)};
+    }
+}
+
+SnapshotHeader __readHeader(std::istream &is) {
+    SnapshotHeader header;
+    if (!is.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+        throw std::runtime_error{"snapshot stream is smaller than its header"};
+    }
+    return header;
+}
+
+std::streamoff __remainingBytes(std::istream &is) {
+    std::istream::pos_type current{is.tellg()};
+    if (current == std::istream::pos_type(-1)) {
+        return -1;
+    }
+    is.seekg(0, std::ios::end);
+    std::istream::pos_type end{is.tellg()};
+    if (end == std::istream::pos_type(-1)) {
+        is.clear();
+        is.seekg(current);
+        return -1;
+    }
+    is.seekg(current);
+    return end - current;
+}
+
+} // namespace __detail
+
+} // namespace snapshot
+
+} // namespace dsa
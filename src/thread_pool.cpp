@@ -0,0 +1,195 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 13:12:36
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-21 09:47:03
+ * @FilePath     : /src/thread_pool.cpp
+ * @Description  :
+ */
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace dsa {
+
+namespace {
+
+// 当前线程所属的线程池及其在池中的编号，用于把嵌套提交的任务放进自己的队列
+thread_local const ThreadPool *__currentPool{nullptr};
+thread_local std::size_t __currentIndex{0};
+
+} // namespace
+
+ThreadPool::ThreadPool(size_type threadCount) :
+    __pending{0}, __nextQueue{0}, __stopping{false} {
+    if (threadCount == 0) {
+        threadCount = std::max<size_type>(std::thread::hardware_concurrency(), 1);
+    }
+    __workers.reserve(threadCount);
+    for (size_type i = 0; i < threadCount; ++i) {
+        __workers.push_back(std::make_unique<__Worker>());
+    }
+    __threads.reserve(threadCount);
+    for (size_type i = 0; i < threadCount; ++i) {
+        __threads.emplace_back(&ThreadPool::__run, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock{__sleepMutex};
+        __stopping = true;
+    }
+    __wakeup.notify_all();
+    for (auto &thread : __threads) {
+        thread.join();
+    }
+}
+
+[[nodiscard]] ThreadPool::size_type ThreadPool::threadCount() const noexcept {
+    return __workers.size();
+}
+
+void ThreadPool::submit(Task task) {
+    size_type self{__currentWorker()};
+    size_type target{self != threadCount() ? self : __nextQueue.fetch_add(1, std::memory_order_relaxed) % threadCount()};
+    {
+        // 先增加计数再入队，计数不会因为任务被立即取走而下溢；
+        // 在 __sleepMutex 内修改计数，避免工作线程检查谓词后、进入等待前错过通知
+        std::lock_guard<std::mutex> lock{__sleepMutex};
+        __pending.fetch_add(1, std::memory_order_release);
+    }
+    try {
+        std::lock_guard<std::mutex> lock{__workers[target]->mutex};
+        __workers[target]->tasks.push_back(std::move(task));
+    } catch (...) {
+        // 入队失败时撤销计数，否则工作线程会一直认为有任务而空转
+        __pending.fetch_sub(1, std::memory_order_relaxed);
+        throw;
+    }
+    __wakeup.notify_one();
+}
+
+void ThreadPool::parallelFor(size_type size, size_type chunkSize, const std::function<void(size_type, size_type)> &body) {
+    if (size == 0) {
+        return;
+    }
+    size_type chunkCount{(size + chunkSize - 1) / chunkSize};
+    if (chunkCount == 1) {
+        body(0, size);
+        return;
+    }
+    // 各分块通过共享计数动态领取，先完成的线程继续领取，负载不均时也能保持所有线程忙碌
+    std::atomic<size_type> nextChunk{0};
+    std::atomic<size_type> activeHelpers{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error{};
+    std::mutex errorMutex{};
+    auto drain{[&]() {
+        for (size_type chunk{nextChunk.fetch_add(1, std::memory_order_relaxed)}; chunk < chunkCount && !failed.load(std::memory_order_relaxed);
+             chunk = nextChunk.fetch_add(1, std::memory_order_relaxed)) {
+            try {
+                body(chunk * chunkSize, std::min(size, (chunk + 1) * chunkSize));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{errorMutex};
+                if (!failed.exchange(true, std::memory_order_relaxed)) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }};
+    size_type helperCount{std::min(chunkCount - 1, threadCount())};
+    activeHelpers.store(helperCount, std::memory_order_relaxed);
+    size_type submitted{0};
+    try {
+        for (; submitted < helperCount; ++submitted) {
+            submit([&]() {
+                drain();
+                activeHelpers.fetch_sub(1, std::memory_order_release);
+            });
+        }
+    } catch (...) {
+        // 已提交的辅助任务仍引用当前栈上的状态，不能直接抛出；扣除未提交的部分，让其余分块尽快结束后再抛出
+        activeHelpers.fetch_sub(helperCount - submitted, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock{errorMutex};
+        if (!failed.exchange(true, std::memory_order_relaxed)) {
+            error = std::current_exception();
+        }
+    }
+    drain();
+    // 辅助任务引用了当前栈上的状态，必须等它们全部结束；等待期间执行其它任务，避免嵌套调用时死锁
+    size_type self{__currentWorker()};
+    Task task{};
+    while (activeHelpers.load(std::memory_order_acquire) != 0) {
+        if (__tryPop(self, task)) {
+            try {
+                task();
+            } catch (...) {
+            }
+            task = nullptr;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+ThreadPool &ThreadPool::global() {
+    static ThreadPool pool{};
+    return pool;
+}
+
+void ThreadPool::__run(size_type self) {
+    __currentPool = this;
+    __currentIndex = self;
+    Task task{};
+    while (true) {
+        if (__tryPop(self, task)) {
+            try {
+                task();
+            } catch (...) {
+            }
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> lock{__sleepMutex};
+        __wakeup.wait(lock, [this]() { return __stopping || __pending.load(std::memory_order_acquire) != 0; });
+        if (__stopping && __pending.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+bool ThreadPool::__tryPop(size_type self, Task &task) {
+    size_type count{threadCount()};
+    if (self < count) {
+        __Worker &own{*__workers[self]};
+        std::lock_guard<std::mutex> lock{own.mutex};
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            __pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    for (size_type i = 1; i <= count; ++i) {
+        __Worker &victim{*__workers[(self + i) % count]};
+        std::lock_guard<std::mutex> lock{victim.mutex};
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            __pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+ThreadPool::size_type ThreadPool::__currentWorker() const noexcept {
+    return __currentPool == this ? __currentIndex : threadCount();
+}
+
+} // namespace dsa
@@ -9,11 +9,20 @@
 
 #include "ArrayList.hpp"
 #include "List.hpp"
+#include "ListAdapter.hpp"
+#include "sort.hpp"
+#include "utility.hpp"
 #include "boost/type_index.hpp"
 #include "boost/uuid/random_generator.hpp"
 #include "boost/uuid/uuid_io.hpp"
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <memory_resource>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 
 class TestObject {
 public:
@@ -230,8 +239,54 @@ public:
         std::cout << "test add() for " << boost::typeindex::type_id_runtime(*__list).pretty_name() << " success." << std::endl;
     }
 
-    // void add(size_type index, const ElementType &element) {
-    // }
+    void addByIndex() {
+        std::cout << "start test add(index, element)." << std::endl;
+
+        assert(__list->size() == 0);
+        // 头部、尾部、中间插入，并触发扩容
+        for (int i = 0; i < 20; ++i) {
+            __list->add(__list->size(), i * 2);
+        }
+        __list->add(0, -1);
+        __list->add(__list->size(), 100);
+        __list->add(5, 7);
+        assert(__list->size() == 23);
+        assert(__list->get(0) == -1);
+        assert(__list->get(1) == 0);
+        assert(__list->get(5) == 7);
+        assert(__list->get(6) == 8);
+        assert(__list->get(__list->size() - 1) == 100);
+        // 插入集合内部的元素
+        __list->add(1, __list->get(5));
+        assert(__list->get(1) == 7);
+        assert(__list->get(6) == 7);
+        assert(__list->size() == 24);
+
+        std::cout << "test add(index, element) for " << boost::typeindex::type_id_runtime(*__list).pretty_name() << " success." << std::endl;
+    }
+
+    void remove() {
+        std::cout << "start test remove()." << std::endl;
+
+        for (int i = 0; i < 100; ++i) {
+            __list->add(i);
+        }
+        assert(__list->remove(0) == 0);
+        assert(__list->remove(__list->size() - 1) == 99);
+        assert(__list->remove(10) == 11);
+        assert(__list->size() == 97);
+        assert(__list->get(9) == 10);
+        assert(__list->get(10) == 12);
+        // 删除过程中会触发缩容
+        while (__list->size() > 1) {
+            __list->remove(__list->size() / 2);
+        }
+        assert(__list->get(0) == 1);
+        assert(__list->remove(0) == 1);
+        assert(__list->isEmpty());
+
+        std::cout << "test remove() for " << boost::typeindex::type_id_runtime(*__list).pretty_name() << " success." << std::endl;
+    }
 
 private:
     std::shared_ptr<ListType> __list;
@@ -243,38 +298,659 @@ private:
 // ElementType set(size_type index, const ElementType &element) {
 // }
 
-// ElementType remove(size_type index) {
-// }
-
 // size_type indexOf(const ElementType &element) {
 // }
 
 // std::string toString(std::function<std::string(const ElementType &)> toString) {
 // }
 
+void testNonTrivialElement() {
+    std::cout << "start test non trivially relocatable element." << std::endl;
+
+    dsa::ArrayList<std::string> list{};
+    for (int i = 0; i < 30; ++i) {
+        list.add(0, std::string(32, static_cast<char>('a' + i % 26)));
+    }
+    list.add(15, "inserted");
+    assert(list.size() == 31);
+    assert(list.get(15) == "inserted");
+    assert(list.get(0) == std::string(32, 'd'));
+    assert(list.remove(15) == "inserted");
+    while (!list.isEmpty()) {
+        list.remove(0);
+    }
+
+    std::cout << "test non trivially relocatable element success." << std::endl;
+}
+
+// 记录拷贝次数的大对象
+class Payload {
+public:
+    explicit Payload(std::size_t size, char c) :
+        __buffer(size, c) {
+    }
+    Payload(const Payload &rhs) :
+        __buffer{rhs.__buffer} {
+        ++copyCount;
+    }
+    Payload(Payload &&) noexcept = default;
+    Payload &operator=(const Payload &rhs) {
+        __buffer = rhs.__buffer;
+        ++copyCount;
+        return *this;
+    }
+    Payload &operator=(Payload &&) noexcept = default;
+
+    char front() const {
+        return __buffer.front();
+    }
+
+    bool operator==(const Payload &rhs) const {
+        return __buffer == rhs.__buffer;
+    }
+
+    inline static uint32_t copyCount{0};
+
+private:
+    std::string __buffer;
+};
+
+void testMoveAwareInsert() {
+    std::cout << "start test move aware add/emplace/set." << std::endl;
+
+    dsa::ArrayList<Payload> list{};
+    for (int i = 0; i < 25; ++i) {
+        list.add(Payload{4096, 'a'});
+    }
+    list.add(3, Payload{4096, 'b'});
+    list.emplace(0, 4096, 'c');
+    list.emplaceBack(4096, 'd');
+    assert(list.emplace(list.size(), 4096, 'e').front() == 'e');
+    Payload old{list.set(1, Payload{4096, 'f'})};
+    assert(old.front() == 'a');
+    assert(list.size() == 29);
+    assert(list.get(0).front() == 'c');
+    assert(list.get(1).front() == 'f');
+    assert(list.get(4).front() == 'b');
+    assert(list.get(27).front() == 'd');
+    assert(Payload::copyCount == 0);
+
+    // 拷贝集合内部的元素
+    list.add(0, list.get(list.size() - 1));
+    list.set(2, list.get(0));
+    assert(Payload::copyCount == 2);
+    assert(list.get(0).front() == 'e');
+    assert(list.get(2).front() == 'e');
+
+    std::cout << "test move aware add/emplace/set success." << std::endl;
+}
+
+// 移动构造未声明 noexcept，剩余构造次数耗尽时抛出异常
+class FragileObject {
+public:
+    explicit FragileObject(int value) :
+        __value{value} {
+        ++liveCount;
+    }
+    FragileObject(const FragileObject &rhs) :
+        __value{rhs.__value} {
+        __consumeBudget();
+        ++liveCount;
+    }
+    FragileObject(FragileObject &&rhs) :
+        __value{rhs.__value} {
+        __consumeBudget();
+        rhs.__value = -1;
+        ++liveCount;
+    }
+    FragileObject &operator=(const FragileObject &) = default;
+    FragileObject &operator=(FragileObject &&) = default;
+    ~FragileObject() {
+        --liveCount;
+    }
+
+    int value() const {
+        return __value;
+    }
+
+    inline static int liveCount{0};
+    // 小于 0 表示不限制构造次数
+    inline static int constructBudget{-1};
+
+private:
+    static void __consumeBudget() {
+        if (constructBudget == 0) {
+            throw std::runtime_error{"construct budget exhausted"};
+        }
+        if (constructBudget > 0) {
+            --constructBudget;
+        }
+    }
+
+    int __value;
+};
+
+void testReallocExceptionSafety() {
+    std::cout << "start test realloc exception safety." << std::endl;
+
+    {
+        dsa::ArrayList<FragileObject> list{};
+        for (int i = 0; list.size() < list.capacity(); ++i) {
+            list.emplaceBack(i);
+        }
+        const auto size{list.size()};
+        auto unchanged{[&list, size]() {
+            if (list.size() != size || FragileObject::liveCount != static_cast<int>(size)) {
+                return false;
+            }
+            for (std::size_t i = 0; i < size; ++i) {
+                if (list.get(i).value() != static_cast<int>(i)) {
+                    return false;
+                }
+            }
+            return true;
+        }};
+        auto expectThrow{[](auto &&operation) {
+            bool thrown{false};
+            try {
+                operation();
+            } catch (const std::runtime_error &) {
+                thrown = true;
+            }
+            FragileObject::constructBudget = -1;
+            return thrown;
+        }};
+
+        // 重定位到一半时抛出异常，旧元素既未被移走也未被析构
+        FragileObject::constructBudget = 3;
+        assert(expectThrow([&list]() { list.emplace(2, 100); }));
+        assert(unchanged());
+        FragileObject::constructBudget = 2;
+        assert(expectThrow([&list, size]() { list.reserve(size * 4); }));
+        assert(unchanged());
+        {
+            std::vector<FragileObject> extra{};
+            extra.emplace_back(200);
+            extra.emplace_back(201);
+            FragileObject::constructBudget = 5;
+            assert(expectThrow([&list, &extra]() { list.insertRange(1, extra.begin(), extra.end()); }));
+        }
+        assert(unchanged());
+
+        list.emplace(1, 100);
+        assert(list.size() == size + 1 && list.get(1).value() == 100 && list.get(size).value() == static_cast<int>(size) - 1);
+    }
+    assert(FragileObject::liveCount == 0);
+
+    std::cout << "test realloc exception safety success." << std::endl;
+}
+
+// 记录向上游申请的每个内存块大小
+class RecordingResource final : public std::pmr::memory_resource {
+public:
+    std::vector<std::size_t> requests;
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        requests.push_back(bytes);
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+};
+
+void testAllocator() {
+    std::cout << "start test allocator aware ArrayList." << std::endl;
+
+    {
+        dsa::MonotonicArena arena{};
+        dsa::ArrayList<int, dsa::ArenaAllocator<int>> list{0, arena};
+        for (int i = 0; i < 1000; ++i) {
+            list.add(i);
+        }
+        assert(list.size() == 1000);
+        assert(list.get(999) == 999);
+        assert(arena.bytesAllocated() >= 1000 * sizeof(int));
+        dsa::ArrayList<int, dsa::ArenaAllocator<int>> moved{std::move(list)};
+        assert(moved.size() == 1000);
+        assert(list.size() == 0);
+        list.add(1);
+        assert(list.get(0) == 1);
+    }
+    {
+        // 每轮 release 后块大小从初始值重新增长，多轮请求向上游申请的块完全相同
+        RecordingResource upstream{};
+        dsa::MonotonicArena arena{256, &upstream};
+        std::vector<std::size_t> firstCycle{};
+        for (int cycle = 0; cycle < 3; ++cycle) {
+            upstream.requests.clear();
+            for (int i = 0; i < 40; ++i) {
+                static_cast<void>(arena.allocate(100));
+            }
+            arena.release();
+            if (cycle == 0) {
+                firstCycle = upstream.requests;
+            }
+            assert(upstream.requests == firstCycle);
+        }
+        assert(firstCycle.front() == 256);
+    }
+    {
+        dsa::SizeClassPool pool{};
+        dsa::ArrayList<std::string, dsa::PoolAllocator<std::string>> list{0, pool};
+        for (int i = 0; i < 100; ++i) {
+            list.add(0, std::to_string(i));
+        }
+        assert(list.get(0) == "99");
+        while (!list.isEmpty()) {
+            list.remove(list.size() - 1);
+        }
+    }
+    {
+        dsa::MonotonicArena arena{};
+        dsa::pmr::ArrayList<std::pmr::string> list{&arena};
+        list.add(std::pmr::string(100, 'x'));
+        list.emplaceBack(100, 'y');
+        // 元素通过 uses-allocator 构造，同样从 arena 中分配
+        assert(list.get(1).get_allocator().resource() == &arena);
+
+        std::pmr::monotonic_buffer_resource otherResource{};
+        dsa::pmr::ArrayList<std::pmr::string> other{&otherResource};
+        other = std::move(list);
+        assert(other.size() == 2);
+        assert(other.get(0) == std::pmr::string(100, 'x'));
+        assert(other.getAllocator().resource() == &otherResource);
+    }
+
+    std::cout << "test allocator aware ArrayList success." << std::endl;
+}
+
+void testGrowthPolicy() {
+    std::cout << "start test growth policy." << std::endl;
+
+    {
+        dsa::ArrayList<int> list{};
+        for (int i = 0; i < 40; ++i) {
+            list.add(i);
+        }
+        assert(list.capacity() == 40);
+        while (list.size() > 9) {
+            list.remove(list.size() - 1);
+        }
+        // 缩容后仍保留一半的空余
+        assert(list.capacity() == 18);
+        // 在缩容阈值附近交替增删不会反复分配内存
+        for (int i = 0; i < 100; ++i) {
+            list.add(i);
+            list.remove(list.size() - 1);
+            assert(list.capacity() == 18);
+        }
+    }
+    {
+        dsa::ArrayList<int, std::allocator<int>, dsa::HalfGrowthPolicy> list{};
+        for (int i = 0; i < 11; ++i) {
+            list.add(i);
+        }
+        assert(list.capacity() == 15);
+        for (int i = 0; i < 5; ++i) {
+            list.add(i);
+        }
+        assert(list.capacity() == 21);
+    }
+    {
+        dsa::ArrayList<int, std::allocator<int>, dsa::NoShrinkGrowthPolicy> list{};
+        for (int i = 0; i < 100; ++i) {
+            list.add(i);
+        }
+        auto capacity{list.capacity()};
+        while (!list.isEmpty()) {
+            list.remove(0);
+        }
+        assert(list.capacity() == capacity);
+        list.shrinkToFit();
+        assert(list.capacity() == dsa::NoShrinkGrowthPolicy::MIN_CAPACITY);
+    }
+    {
+        dsa::ArrayList<int> list{};
+        list.reserve(1000);
+        assert(list.capacity() == 1000);
+        for (int i = 0; i < 1000; ++i) {
+            list.add(i);
+        }
+        while (!list.isEmpty()) {
+            list.remove(list.size() - 1);
+        }
+        assert(list.capacity() == 1000);
+        list.add(1);
+        list.shrinkToFit();
+        assert(list.capacity() == dsa::DefaultGrowthPolicy::MIN_CAPACITY);
+        assert(list.get(0) == 1);
+    }
+
+    std::cout << "test growth policy success." << std::endl;
+}
+
+void testRangeOperation() {
+    std::cout << "start test range operation." << std::endl;
+
+    {
+        dsa::ArrayList<int> list{};
+        std::vector<int> source(100);
+        std::iota(source.begin(), source.end(), 0);
+        list.addAll(source.begin(), source.end());
+        assert(list.size() == 100);
+        std::vector<int> middle{-1, -2, -3};
+        list.insertRange(50, middle.begin(), middle.end());
+        assert(list.size() == 103);
+        assert(list.get(49) == 49);
+        assert(list.get(50) == -1);
+        assert(list.get(52) == -3);
+        assert(list.get(53) == 50);
+        list.removeRange(50, 53);
+        assert(list.size() == 100);
+        assert(list.get(50) == 50);
+        assert(list.removeIf([](int e) { return e % 2 == 0; }) == 50);
+        assert(list.size() == 50);
+        assert(list.get(0) == 1);
+        assert(list.get(49) == 99);
+        list.removeRange(0, list.size());
+        assert(list.isEmpty());
+        // 批量删除只缩容一次
+        assert(list.capacity() == dsa::DefaultGrowthPolicy::MIN_CAPACITY);
+    }
+    {
+        // 单遍输入迭代器
+        dsa::ArrayList<std::string> list{};
+        list.add("head");
+        list.add("tail");
+        std::istringstream input{"a b c d e f g h i j k l"};
+        list.insertRange(1, std::istream_iterator<std::string>{input}, std::istream_iterator<std::string>{});
+        assert(list.size() == 14);
+        assert(list.get(0) == "head");
+        assert(list.get(1) == "a");
+        assert(list.get(12) == "l");
+        assert(list.get(13) == "tail");
+        std::vector<std::string> more(30, "x");
+        list.insertRange(2, more.begin(), more.end());
+        assert(list.size() == 44);
+        assert(list.get(1) == "a");
+        assert(list.get(31) == "x");
+        assert(list.get(32) == "b");
+        assert(list.removeIf([](const std::string &e) { return e == "x"; }) == 30);
+        list.removeRange(1, 13);
+        assert(list.size() == 2);
+        assert(list.get(1) == "tail");
+    }
+    {
+        dsa::ArrayList<int> list{};
+        bool thrown{false};
+        try {
+            list.removeRange(0, 1);
+        } catch (const std::out_of_range &) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    std::cout << "test range operation success." << std::endl;
+}
+
+void testSearch() {
+    std::cout << "start test indexOf/lastIndexOf/count." << std::endl;
+
+    {
+        dsa::ArrayList<long> list{};
+        for (long i = 0; i < 1000; ++i) {
+            list.add(i % 100);
+        }
+        assert(list.contains(99));
+        assert(!list.contains(100));
+        assert(list.indexOf(42) == 42);
+        assert(list.lastIndexOf(42) == 942);
+        assert(list.count(42) == 10);
+        assert(list.indexOf(-1) == dsa::ArrayList<long>::npos);
+        assert(list.lastIndexOf(-1) == dsa::ArrayList<long>::npos);
+    }
+    {
+        dsa::ArrayList<std::string> list{};
+        list.add("a");
+        list.add("b");
+        list.add("a");
+        assert(list.indexOf("a") == 0);
+        assert(list.lastIndexOf("a") == 2);
+        assert(list.count("a") == 2);
+        assert(list.lastIndexOf("c") == dsa::ArrayList<std::string>::npos);
+    }
+
+    std::cout << "test indexOf/lastIndexOf/count success." << std::endl;
+}
+
+// 只依赖 StaticList 接口的模板算法，调用在编译期确定
+template <typename Derived>
+long sumOf(const dsa::StaticList<Derived> &list) {
+    long sum{0};
+    for (typename dsa::StaticList<Derived>::size_type i = 0; i < list.size(); ++i) {
+        sum += list.get(i);
+    }
+    return sum;
+}
+
+void testStaticList() {
+    std::cout << "start test StaticList." << std::endl;
+
+    dsa::ArrayList<int> list{};
+    dsa::StaticList<dsa::ArrayList<int>> &base{list};
+    for (int i = 1; i <= 100; ++i) {
+        base.add(i);
+    }
+    base.add(0, 0);
+    assert(sumOf(list) == 5050);
+    assert(base.size() == 101);
+    assert(!base.isEmpty());
+    assert(base.contains(100));
+    assert(base.indexOf(50) == 50);
+    assert(base.set(0, -1) == 0);
+    assert(base.remove(0) == -1);
+    bool thrown{false};
+    try {
+        static_cast<void>(base.get(100));
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+    base.clear();
+    assert(base.isEmpty());
+    static_assert(!std::is_polymorphic_v<dsa::ArrayList<int>>);
+
+    // 需要运行时多态时通过 ListAdapter 擦除类型
+    dsa::ListAdapter<dsa::ArrayList<int>> adapter{};
+    dsa::List<int> &erased{adapter};
+    erased.add(1);
+    erased.add(0, 2);
+    assert(adapter.getList().get(0) == 2);
+    assert(erased.toString([](const int &e) { return std::to_string(e); }) == "[2, 1]");
+
+    std::cout << "test StaticList success." << std::endl;
+}
+
+void testIterator() {
+    std::cout << "start test iterator." << std::endl;
+
+    using List = dsa::ArrayList<int>;
+    static_assert(std::is_same_v<std::iterator_traits<List::iterator>::iterator_category, std::random_access_iterator_tag>);
+    static_assert(std::is_convertible_v<List::iterator, List::const_iterator>);
+    static_assert(!std::is_convertible_v<List::const_iterator, List::iterator>);
+
+    List list{};
+    for (int i = 0; i < 100; ++i) {
+        list.add((i * 37) % 100);
+    }
+    std::sort(list.begin(), list.end());
+    assert(std::is_sorted(list.cbegin(), list.cend()));
+    assert(std::distance(list.begin(), list.end()) == 100);
+    assert(*std::lower_bound(list.begin(), list.end(), 42) == 42);
+    assert(list.end() - list.begin() == 100);
+    assert(list.begin()[10] == 10);
+    assert(list.begin() + 100 == list.cend());
+    assert(list.cbegin() < list.end());
+    assert(*list.rbegin() == 99);
+    assert(*(list.crend() - 1) == 0);
+
+    int expected{0};
+    for (const int &e : list) {
+        assert(e == expected++);
+    }
+
+    std::reverse(list.begin(), list.end());
+    dsa::bubbleSort(list.begin(), list.end());
+    assert(std::is_sorted(list.begin(), list.end()));
+    std::reverse(list.begin(), list.end());
+    dsa::selectionSort(list.begin(), list.end());
+    assert(std::is_sorted(list.begin(), list.end()));
+    std::reverse(list.begin(), list.end());
+    dsa::insertionSort(list.begin(), list.end());
+    assert(std::is_sorted(list.begin(), list.end()));
+
+    dsa::Span<int> span{list.span()};
+    assert(span.data() == list.data());
+    assert(span.size() == list.size());
+    assert(span.subspan(90).size() == 10 && span.subspan(90)[0] == 90);
+    assert(span.first(3).size() == 3 && span.last(1)[0] == 99);
+    span[0] = -1;
+    assert(list.get(0) == -1);
+    const List &constList{list};
+    dsa::Span<const int> constSpan{constList.span()};
+    assert(std::accumulate(constSpan.begin(), constSpan.end(), 0) == 4949);
+
+    std::cout << "test iterator success." << std::endl;
+}
+
+void testBoundsCheck() {
+    std::cout << "start test bounds check." << std::endl;
+
+    dsa::ArrayList<int> checked{};
+    dsa::ArrayList<int, std::allocator<int>, dsa::DefaultGrowthPolicy, dsa::BoundsUnchecked> unchecked{};
+    for (int i = 0; i < 10; ++i) {
+        checked.add(i);
+        unchecked.add(i);
+    }
+    checked[0] = 10;
+    unchecked[0] = 10;
+    assert(checked.getUnchecked(0) == 10 && unchecked.get(0) == 10);
+    const auto &constChecked{checked};
+    assert(constChecked[9] == 9);
+
+    // 通过 StaticList 基类访问 operator[] 同样不做检查
+    dsa::StaticList<dsa::ArrayList<int>> &base{checked};
+    int sum{0};
+    for (std::size_t i = 0; i < base.size(); ++i) {
+        sum += base[i];
+    }
+    assert(sum == 55);
+
+    bool thrown{false};
+    try {
+        static_cast<void>(checked.get(10));
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+    static_assert(!noexcept(dsa::BoundsChecked::checkIndex<dsa::ListIndexChecker::Operation::GET>(0, 0)));
+    static_assert(noexcept(dsa::BoundsUnchecked::checkIndex<dsa::ListIndexChecker::Operation::GET>(0, 0)));
+    static_assert(dsa::ListIndexChecker::isValidIndex<dsa::ListIndexChecker::Operation::ADD_BY_INDEX>(10, 10));
+    static_assert(!dsa::ListIndexChecker::isValidIndex<dsa::ListIndexChecker::Operation::GET>(10, 10));
+
+    std::cout << "test bounds check success." << std::endl;
+}
+
+void testFormat() {
+    std::cout << "start test format." << std::endl;
+
+    dsa::ArrayList<int> ints{};
+    std::string text{};
+    ints.formatTo(std::back_inserter(text));
+    assert(text == "[]");
+    for (int i = -2; i <= 2; ++i) {
+        ints.add(i);
+    }
+    text.clear();
+    ints.formatTo(std::back_inserter(text));
+    assert(text == "[-2, -1, 0, 1, 2]");
+    assert(ints.toString([](const int &e) { return std::to_string(e); }) == text);
+
+    dsa::ArrayList<double> doubles{};
+    doubles.add(0.5);
+    doubles.add(-1e10);
+    std::ostringstream stream{};
+    doubles.writeTo(stream);
+    assert(stream.str() == "[0.5, -1e+10]");
+
+    dsa::ArrayList<std::string> strings{};
+    strings.add("a");
+    strings.add("bc");
+    stream.str("");
+    strings.writeTo(stream) << '\n';
+    assert(stream.str() == "[a, bc]\n");
+
+    // 自定义格式化方法直接写输出迭代器
+    stream.str("");
+    ints.writeTo(stream, [](auto out, int e) {
+        *out = e < 0 ? '-' : '+';
+        return ++out;
+    });
+    assert(stream.str() == "[-, -, +, +, +]");
+
+    std::cout << "test format success." << std::endl;
+}
+
 int main() {
     {
-        ListTest<int> test{new dsa::ArrayList<int>{}};
+        ListTest<int> test{new dsa::ListAdapter<dsa::ArrayList<int>>{}};
         test.clear();
     }
     {
-        ListTest<TestObject> test{new dsa::ArrayList<TestObject>{}};
+        ListTest<int> test{new dsa::ListAdapter<dsa::ArrayList<int>>{}};
+        test.addByIndex();
+    }
+    {
+        ListTest<int> test{new dsa::ListAdapter<dsa::ArrayList<int>>{}};
+        test.remove();
+    }
+    testNonTrivialElement();
+    testMoveAwareInsert();
+    testReallocExceptionSafety();
+    testAllocator();
+    testGrowthPolicy();
+    testRangeOperation();
+    testSearch();
+    testStaticList();
+    testBoundsCheck();
+    testFormat();
+    testIterator();
+    {
+        ListTest<TestObject> test{new dsa::ListAdapter<dsa::ArrayList<TestObject>>{}};
         test.clear();
     }
     // {
-    //     ListTest<int> test{new dsa::ArrayList<int>{}};
+    //     ListTest<int> test{new dsa::ListAdapter<dsa::ArrayList<int>>{}};
     //     test.size();
     // }
     // {
-    //     ListTest<TestObject> test{new dsa::ArrayList<TestObject>{}};
+    //     ListTest<TestObject> test{new dsa::ListAdapter<dsa::ArrayList<TestObject>>{}};
     //     test.size();
     // }
     // {
-    //     ListTest<int> test{new dsa::ArrayList<int>{}};
+    //     ListTest<int> test{new dsa::ListAdapter<dsa::ArrayList<int>>{}};
     //     test.add();
     // }
     // {
-    //     ListTest<TestObject> test{new dsa::ArrayList<TestObject>{}};
+    //     ListTest<TestObject> test{new dsa::ListAdapter<dsa::ArrayList<TestObject>>{}};
     //     test.add();
     // }
     return 0;
@@ -0,0 +1,79 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 16:58:40
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 16:58:40
+ * @FilePath     : /test/testArrayListStats.cpp
+ * @Description  :
+ */
+
+#define DSA_ARRAY_LIST_STATS
+
+#include "ArrayList.hpp"
+#include <cassert>
+#include <iostream>
+#include <utility>
+
+void testInstanceStats() {
+    std::cout << "start test instance stats." << std::endl;
+
+    dsa::resetGlobalArrayListStats();
+    // 默认策略：最小容量 10，两倍扩容，元素少于容量的 1/4 时缩到元素数量的 2 倍
+    dsa::ArrayList<int> list{};
+    assert(list.stats().growCount == 0 && list.stats().bytesAllocated == 10 * sizeof(int) && list.stats().peakCapacity == 10);
+    for (int i = 0; i < 41; ++i) {
+        list.add(i);
+    }
+    // 10 -> 20 -> 40 -> 80，依次重定位 10、20、40 个元素
+    const dsa::ArrayListStats &stats{list.stats()};
+    assert(stats.growCount == 3 && stats.shrinkCount == 0);
+    assert(stats.elementsMoved == 70 && stats.peakCapacity == 80);
+    assert(stats.bytesAllocated == (10 + 20 + 40 + 80) * sizeof(int));
+
+    while (list.size() > 19) {
+        list.remove(list.size() - 1);
+    }
+    // 元素降到 19 个时 80 -> 38
+    assert(list.capacity() == 38 && stats.shrinkCount == 1 && stats.elementsMoved == 89);
+    list.shrinkToFit();
+    assert(list.capacity() == 19 && stats.shrinkCount == 2 && stats.peakCapacity == 80);
+    list.reserve(100);
+    assert(stats.growCount == 4 && stats.peakCapacity == 100);
+
+    // 统计随内存一起转移
+    dsa::ArrayList<int> moved{std::move(list)};
+    assert(moved.stats().growCount == 4 && list.stats().growCount == 0);
+
+    std::cout << "test instance stats success." << std::endl;
+}
+
+void testGlobalStats() {
+    std::cout << "start test global stats." << std::endl;
+
+    dsa::resetGlobalArrayListStats();
+    {
+        dsa::ArrayList<long> first{};
+        dsa::ArrayList<long> second{};
+        for (int i = 0; i < 100; ++i) {
+            first.add(i);
+        }
+        for (int i = 0; i < 300; ++i) {
+            second.emplace(0, i);
+        }
+        dsa::ArrayListStats global{dsa::globalArrayListStats()};
+        assert(global.growCount == first.stats().growCount + second.stats().growCount);
+        assert(global.elementsMoved == first.stats().elementsMoved + second.stats().elementsMoved);
+        assert(global.bytesAllocated == first.stats().bytesAllocated + second.stats().bytesAllocated);
+        assert(global.peakCapacity == second.stats().peakCapacity && global.peakCapacity >= 300);
+    }
+    dsa::resetGlobalArrayListStats();
+    assert(dsa::globalArrayListStats().growCount == 0 && dsa::globalArrayListStats().peakCapacity == 0);
+
+    std::cout << "test global stats success." << std::endl;
+}
+
+int main() {
+    testInstanceStats();
+    testGlobalStats();
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 20:05:12
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-21 09:12:40
+ * @FilePath     : /test/testConcurrentArrayList.cpp
+ * @Description  :
+ */
+
+#include "ConcurrentArrayList.hpp"
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+void testSingleThread() {
+    std::cout << "start test single thread." << std::endl;
+
+    dsa::ConcurrentArrayList<std::string> list{};
+    assert(list.isEmpty());
+    std::vector<const std::string *> addresses{};
+    for (int i = 0; i < 1000; ++i) {
+        assert(list.add(std::to_string(i)) == static_cast<std::size_t>(i));
+        addresses.push_back(&list.get(i));
+    }
+    assert(list.size() == 1000);
+    // 分段不会移动，之前取得的地址依旧有效
+    for (int i = 0; i < 1000; ++i) {
+        assert(addresses[i] == &list.get(i) && *addresses[i] == std::to_string(i));
+    }
+    assert(list.indexOf("999") == 999 && !list.contains("1000"));
+    bool thrown{false};
+    try {
+        static_cast<void>(list.get(1000));
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+    list.clear();
+    assert(list.isEmpty());
+    list.emplaceBack(3, 'a');
+    assert(list.toString([](const std::string &e) { return e; }) == "[aaa]");
+
+    std::cout << "test single thread success." << std::endl;
+}
+
+void testConcurrentAppend() {
+    std::cout << "start test concurrent append." << std::endl;
+
+    constexpr int threadCount{8};
+    constexpr int perThread{20000};
+    dsa::ConcurrentArrayList<long> list{};
+    std::vector<std::thread> writers{};
+    for (int t = 0; t < threadCount; ++t) {
+        writers.emplace_back([&list, t]() {
+            for (int i = 0; i < perThread; ++i) {
+                list.add(static_cast<long>(t) * perThread + i);
+            }
+        });
+    }
+    // 写入过程中读者只能看到已发布的元素
+    std::thread reader{[&list]() {
+        std::size_t seen{0};
+        while (seen < threadCount * perThread) {
+            std::size_t size{list.size()};
+            assert(size >= seen);
+            for (; seen < size; ++seen) {
+                long value{list.get(seen)};
+                assert(value >= 0 && value < threadCount * perThread);
+            }
+        }
+    }};
+    for (auto &writer : writers) {
+        writer.join();
+    }
+    reader.join();
+
+    assert(list.size() == threadCount * perThread);
+    std::vector<bool> found(threadCount * perThread, false);
+    list.forEach([&found](long value) {
+        assert(!found[value]);
+        found[value] = true;
+    });
+    for (bool f : found) {
+        assert(f);
+    }
+
+    std::cout << "test concurrent append success." << std::endl;
+}
+
+// 为 true 时 FailingAllocator 的下一次分配抛出 std::bad_alloc，rebind 后的分配器共享该开关
+bool failNextAllocation{false};
+
+template <typename T>
+class FailingAllocator {
+public:
+    using value_type = T;
+
+    FailingAllocator() = default;
+    template <typename U>
+    FailingAllocator(const FailingAllocator<U> &) noexcept {
+    }
+
+    T *allocate(std::size_t n) {
+        if (failNextAllocation) {
+            failNextAllocation = false;
+            throw std::bad_alloc{};
+        }
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const FailingAllocator<U> &) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const FailingAllocator<U> &) const noexcept {
+        return false;
+    }
+};
+
+void testAllocationFailure() {
+    std::cout << "start test allocation failure." << std::endl;
+
+    dsa::ConcurrentArrayList<std::string, FailingAllocator<std::string>> list{};
+    // 第一个分段容量为 16，第 17 个元素需要新的分段
+    for (int i = 0; i < 16; ++i) {
+        list.add(std::to_string(i));
+    }
+    failNextAllocation = true;
+    bool thrown{false};
+    try {
+        list.add("lost");
+    } catch (const std::bad_alloc &) {
+        thrown = true;
+    }
+    assert(thrown && list.size() == 16);
+    // 分配失败没有占用槽位，之后的追加仍然可以发布
+    assert(list.add("16") == 16 && list.add("17") == 17);
+    assert(list.size() == 18 && list.get(17) == "17");
+
+    std::cout << "test allocation failure success." << std::endl;
+}
+
+int main() {
+    testSingleThread();
+    testConcurrentAppend();
+    testAllocationFailure();
+    return 0;
+}
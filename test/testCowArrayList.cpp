@@ -0,0 +1,139 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 15:52:30
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 15:52:30
+ * @FilePath     : /test/testCowArrayList.cpp
+ * @Description  :
+ */
+
+#include "CowArrayList.hpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+void testRandomEdit() {
+    std::cout << "start test random edit." << std::endl;
+
+    // 块容量为 8，少量元素就能覆盖跨块移动
+    dsa::CowArrayList<std::string, 3> list{};
+    std::vector<std::string> expected{};
+    std::mt19937 random{20261019};
+    for (int round = 0; round < 5000; ++round) {
+        std::size_t operation{random() % 4};
+        if (operation == 0 || expected.empty()) {
+            std::size_t index{random() % (expected.size() + 1)};
+            list.add(index, std::to_string(round));
+            expected.insert(expected.begin() + index, std::to_string(round));
+        } else if (operation == 1) {
+            std::size_t index{random() % expected.size()};
+            assert(list.remove(index) == expected[index]);
+            expected.erase(expected.begin() + index);
+        } else if (operation == 2) {
+            std::size_t index{random() % expected.size()};
+            assert(list.set(index, std::to_string(-round)) == expected[index]);
+            expected[index] = std::to_string(-round);
+        } else {
+            list.add(std::to_string(round));
+            expected.push_back(std::to_string(round));
+        }
+        if (round % 97 == 0) {
+            // 定期取快照，迫使后续修改走复制路径
+            static_cast<void>(list.snapshot());
+        }
+    }
+    assert(list.size() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        assert(list.get(i) == expected[i] && list[i] == expected[i]);
+    }
+    assert(list.indexOf(expected.back()) == expected.size() - 1);
+    bool thrown{false};
+    try {
+        static_cast<void>(list.get(list.size()));
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "test random edit success." << std::endl;
+}
+
+void testSnapshot() {
+    std::cout << "start test snapshot." << std::endl;
+
+    using List = dsa::CowArrayList<int, 4>;
+    List list{};
+    for (int i = 0; i < 100; ++i) {
+        list.add(i);
+    }
+    assert(!list.isShared());
+    auto snapshot{list.snapshot()};
+    assert(list.isShared());
+    list.set(0, -1);
+    list.add(50, -2);
+    list.remove(99);
+    list.add(100);
+    // 修改后块表已复制，快照看到的仍是取快照时的内容
+    assert(!list.isShared());
+    assert(snapshot.size() == 100 && snapshot.get(0) == 0 && snapshot.get(50) == 50 && snapshot.get(99) == 99);
+    assert(snapshot.indexOf(-1) == List::npos && !snapshot.contains(-2));
+    assert(list.get(0) == -1 && list.get(50) == -2 && list.get(100) == 100 && list.size() == 101);
+
+    List copy{list};
+    assert(copy.isShared());
+    copy.set(1, 1000);
+    assert(list.get(1) == 1 && copy.get(1) == 1000);
+    list.clear();
+    assert(list.isEmpty() && copy.size() == 101);
+
+    List small{};
+    small.add(1);
+    small.add(2);
+    assert(small.toString([](int e) { return std::to_string(e); }) == "[1, 2]");
+    assert(small.snapshot().toString([](int e) { return std::to_string(e); }) == "[1, 2]");
+
+    std::cout << "test snapshot success." << std::endl;
+}
+
+void testConcurrentReader() {
+    std::cout << "start test concurrent reader." << std::endl;
+
+    dsa::CowArrayList<long, 6> list{};
+    for (long i = 0; i < 10000; ++i) {
+        list.add(i);
+    }
+    auto snapshot{list.snapshot()};
+    // 读者无锁遍历快照，写者同时修改集合
+    std::thread reader{[snapshot]() {
+        for (int round = 0; round < 20; ++round) {
+            long expected{0};
+            snapshot.forEach([&expected](long e) {
+                assert(e == expected);
+                ++expected;
+            });
+            assert(expected == 10000);
+        }
+    }};
+    for (long i = 0; i < 10000; i += 3) {
+        list.set(static_cast<std::size_t>(i), -i);
+        if (i % 300 == 0) {
+            list.add(0, i);
+            snapshot = list.snapshot();
+        }
+    }
+    reader.join();
+    assert(list.size() == 10034);
+
+    std::cout << "test concurrent reader success." << std::endl;
+}
+
+int main() {
+    testRandomEdit();
+    testSnapshot();
+    testConcurrentReader();
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 21:48:05
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 21:48:05
+ * @FilePath     : /test/testIndexedPQType.cpp
+ * @Description  :
+ */
+
+#include "IndexedPQType.hpp"
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+void testHandle() {
+    std::cout << "start test handle." << std::endl;
+
+    dsa::IndexedPQType<int> queue{};
+    auto h1{queue.enqueue(10)};
+    auto h2{queue.enqueue(20)};
+    auto h3{queue.emplace(30)};
+    assert(queue.size() == 3 && queue.top() == 30 && queue.topHandle() == h3);
+    assert(queue.contains(h1) && queue.get(h2) == 20);
+
+    // 提高、降低优先级
+    queue.updatePriority(h1, 40);
+    assert(queue.topHandle() == h1);
+    queue.updatePriority(h1, 5);
+    assert(queue.top() == 30 && queue.get(h1) == 5);
+
+    assert(queue.erase(h3) == 30 && !queue.contains(h3) && queue.top() == 20);
+    bool thrown{false};
+    try {
+        queue.erase(h3);
+    } catch (const dsa::QueueException &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // 槽位被复用后旧句柄仍然失效
+    auto h4{queue.enqueue(30)};
+    assert(h4 != h3 && !queue.contains(h3) && queue.contains(h4));
+    assert(queue.dequeue() == 30 && !queue.contains(h4));
+    assert(!queue.contains(decltype(h1){}));
+
+    dsa::IndexedPQType<int> moved{std::move(queue)};
+    assert(moved.contains(h1) && moved.contains(h2) && queue.isEmpty());
+    moved.makeEmpty();
+    assert(moved.isEmpty() && !moved.contains(h1));
+    queue.enqueue(1);
+    assert(queue.top() == 1);
+
+    std::cout << "test handle success." << std::endl;
+}
+
+void testRandomOperation() {
+    std::cout << "start test random operation." << std::endl;
+
+    using Queue = dsa::IndexedPQType<std::pair<int, int>, 4, std::greater<std::pair<int, int>>>;
+    Queue queue{};
+    std::set<std::pair<int, int>> expected{};
+    std::vector<Queue::Handle> handles{};
+    std::mt19937 random{20261019};
+    for (int round = 0; round < 20000; ++round) {
+        std::size_t operation{random() % 4};
+        if (operation == 0 || expected.empty()) {
+            std::pair<int, int> e{static_cast<int>(random() % 1000), round};
+            handles.push_back(queue.enqueue(e));
+            expected.insert(e);
+        } else {
+            Queue::Handle handle{handles[random() % handles.size()]};
+            if (!queue.contains(handle)) {
+                continue;
+            }
+            std::pair<int, int> old{queue.get(handle)};
+            if (operation == 1) {
+                std::pair<int, int> e{static_cast<int>(random() % 1000), round};
+                queue.updatePriority(handle, e);
+                expected.erase(old);
+                expected.insert(e);
+            } else if (operation == 2) {
+                assert(queue.erase(handle) == old);
+                expected.erase(old);
+            } else {
+                assert(queue.dequeue() == *expected.begin());
+                expected.erase(expected.begin());
+            }
+        }
+        assert(queue.size() == expected.size());
+    }
+    while (!queue.isEmpty()) {
+        assert(queue.dequeue() == *expected.begin());
+        expected.erase(expected.begin());
+    }
+    assert(expected.empty());
+
+    std::cout << "test random operation success." << std::endl;
+}
+
+void testDijkstra() {
+    std::cout << "start test dijkstra." << std::endl;
+
+    // 0 -> 1 (4), 0 -> 2 (1), 2 -> 1 (2), 1 -> 3 (1), 2 -> 3 (5)
+    std::vector<std::vector<std::pair<int, int>>> graph{{{1, 4}, {2, 1}}, {{3, 1}}, {{1, 2}, {3, 5}}, {}};
+    using Queue = dsa::IndexedPQType<std::pair<int, int>, 2, std::greater<std::pair<int, int>>>;
+    Queue queue{};
+    std::vector<Queue::Handle> handles(graph.size());
+    std::vector<int> distance(graph.size(), std::numeric_limits<int>::max());
+    distance[0] = 0;
+    handles[0] = queue.enqueue({0, 0});
+    std::size_t maxSize{0};
+    while (!queue.isEmpty()) {
+        auto [d, u]{queue.dequeue()};
+        for (auto [v, w] : graph[u]) {
+            if (d + w < distance[v]) {
+                distance[v] = d + w;
+                if (queue.contains(handles[v])) {
+                    queue.updatePriority(handles[v], {distance[v], v});
+                } else {
+                    handles[v] = queue.enqueue({distance[v], v});
+                }
+            }
+        }
+        maxSize = std::max(maxSize, queue.size());
+    }
+    assert((distance == std::vector<int>{0, 3, 1, 4}));
+    // 每个顶点最多在队列中出现一次
+    assert(maxSize <= graph.size());
+
+    std::cout << "test dijkstra success." << std::endl;
+}
+
+int main() {
+    testHandle();
+    testRandomOperation();
+    testDijkstra();
+    return 0;
+}
@@ -0,0 +1,179 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 18:20:05
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 18:20:05
+ * @FilePath     : /test/testLinkedList.cpp
+ * @Description  :
+ */
+
+#include "LinkedList.hpp"
+#include "ListAdapter.hpp"
+#include <cassert>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+template <typename T>
+bool equals(const dsa::LinkedList<T> &list, const std::list<T> &expected) {
+    if (list.size() != expected.size()) {
+        return false;
+    }
+    auto it{expected.begin()};
+    for (const T &element : list) {
+        if (element != *it++) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testIndexOperation() {
+    std::cout << "start test index operation." << std::endl;
+
+    dsa::LinkedList<std::string> list{};
+    std::list<std::string> expected{};
+    std::mt19937 random{20261019};
+    for (int round = 0; round < 3000; ++round) {
+        std::size_t operation{random() % 3};
+        if (operation == 0 || expected.empty()) {
+            std::size_t index{random() % (expected.size() + 1)};
+            list.add(index, std::to_string(round));
+            expected.insert(std::next(expected.begin(), index), std::to_string(round));
+        } else if (operation == 1) {
+            std::size_t index{random() % expected.size()};
+            assert(list.remove(index) == *std::next(expected.begin(), index));
+            expected.erase(std::next(expected.begin(), index));
+        } else {
+            std::size_t index{random() % expected.size()};
+            assert(list.set(index, std::to_string(-round)) == *std::next(expected.begin(), index));
+            *std::next(expected.begin(), index) = std::to_string(-round);
+        }
+    }
+    assert(equals(list, expected));
+    assert(list.get(list.size() - 1) == expected.back() && list[0] == expected.front());
+    assert(list.indexOf(expected.back()) == expected.size() - 1 && !list.contains("none"));
+
+    list.addFirst("first");
+    list.add("last");
+    assert(list.getFirst() == "first" && list.getLast() == "last");
+    assert(list.removeFirst() == "first" && list.removeLast() == "last");
+    list.clear();
+    bool thrown{false};
+    try {
+        list.removeFirst();
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown && list.isEmpty());
+
+    std::cout << "test index operation success." << std::endl;
+}
+
+void testIterator() {
+    std::cout << "start test iterator." << std::endl;
+
+    auto pool{std::make_shared<dsa::LinkedList<int>::Pool>(16)};
+    dsa::LinkedList<int> list{pool};
+    for (int i = 0; i < 10; ++i) {
+        list.add(i);
+    }
+    // 删除所有偶数，在每个奇数前插入其相反数
+    for (auto it{list.begin()}; it != list.end();) {
+        if (*it % 2 == 0) {
+            it = list.erase(it);
+        } else {
+            list.insert(it, -*it);
+            ++it;
+        }
+    }
+    assert(list.toString([](int e) { return std::to_string(e); }) == "[-1, 1, -3, 3, -5, 5, -7, 7, -9, 9]");
+    std::ostringstream os{};
+    list.writeTo(os);
+    assert(os.str() == "[-1, 1, -3, 3, -5, 5, -7, 7, -9, 9]");
+
+    // 节点被归还到节点池后重复使用，不再向堆申请
+    std::size_t capacity{pool->capacity()};
+    for (int round = 0; round < 100; ++round) {
+        list.emplace(list.cbegin(), round);
+        list.erase(list.cbegin());
+    }
+    assert(pool->capacity() == capacity && pool->available() == capacity - list.size());
+    pool->reserve(1000);
+    assert(pool->available() >= 1000);
+
+    dsa::LinkedList<int> moved{std::move(list)};
+    assert(moved.size() == 10 && list.isEmpty() && moved.pool() == pool);
+    list = std::move(moved);
+    assert(list.size() == 10 && *std::prev(list.cend()) == 9);
+
+    std::cout << "test iterator success." << std::endl;
+}
+
+void testSplice() {
+    std::cout << "start test splice." << std::endl;
+
+    dsa::LinkedList<int> first{};
+    dsa::LinkedList<int> second{first.pool()};
+    for (int i = 0; i < 5; ++i) {
+        first.add(i);
+        second.add(10 + i);
+    }
+    // 共享节点池时只移动指针，元素地址保持不变
+    const int *address{&*second.begin()};
+    first.splice(std::next(first.cbegin(), 2), second);
+    assert(second.isEmpty() && first.size() == 10);
+    assert(first.toString([](int e) { return std::to_string(e); }) == "[0, 1, 10, 11, 12, 13, 14, 2, 3, 4]");
+    assert(&first.get(2) == address);
+
+    second.splice(second.cend(), first, std::next(first.cbegin(), 2), std::next(first.cbegin(), 7));
+    assert(first.size() == 5 && second.size() == 5 && second.getFirst() == 10);
+    first.splice(first.cbegin(), first, std::prev(first.cend()));
+    assert(first.toString([](int e) { return std::to_string(e); }) == "[4, 0, 1, 2, 3]");
+
+    // 节点池不同时逐个移动元素
+    dsa::LinkedList<int> other{};
+    other.add(100);
+    other.add(200);
+    first.splice(first.cend(), other);
+    assert(other.isEmpty() && first.size() == 7 && first.getLast() == 200);
+    other.add(300);
+    first.splice(first.cbegin(), other, other.cbegin());
+    assert(other.isEmpty() && first.getFirst() == 300);
+
+    bool thrown{false};
+    try {
+        dsa::LinkedList<int> invalid{nullptr};
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "test splice success." << std::endl;
+}
+
+void testAdapter() {
+    std::cout << "start test adapter." << std::endl;
+
+    std::unique_ptr<dsa::List<int>> list{std::make_unique<dsa::ListAdapter<dsa::LinkedList<int>>>()};
+    for (int i = 0; i < 5; ++i) {
+        list->add(0, i);
+    }
+    assert(list->size() == 5 && list->get(0) == 4 && list->indexOf(0) == 4);
+    assert(list->remove(2) == 2 && list->toString([](int e) { return std::to_string(e); }) == "[4, 3, 1, 0]");
+
+    std::cout << "test adapter success." << std::endl;
+}
+
+int main() {
+    testIndexOperation();
+    testIterator();
+    testSplice();
+    testAdapter();
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 22:01:19
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 22:01:19
+ * @FilePath     : /test/testMmapArrayList.cpp
+ * @Description  :
+ */
+
+#include "ListAdapter.hpp"
+#include "MmapArrayList.hpp"
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <unistd.h>
+
+std::string temporaryPath(const std::string &name) {
+    return "/tmp/dsa_" + name + "_" + std::to_string(::getpid()) + ".bin";
+}
+
+void testPersistence() {
+    std::cout << "start test persistence." << std::endl;
+
+    std::string path{temporaryPath("mmap_list")};
+    std::remove(path.c_str());
+    {
+        dsa::MmapArrayList<std::uint64_t> list{path};
+        assert(list.isEmpty());
+        for (std::uint64_t i = 0; i < 100000; ++i) {
+            list.add(i * i);
+        }
+        list.add(0, 42);
+        assert(list.remove(1) == 0);
+        assert(list.set(1, 7) == 1);
+        list.sync();
+    }
+    {
+        // 重新打开后直接使用文件中的数据
+        dsa::MmapArrayList<std::uint64_t> list{path};
+        assert(list.size() == 100000);
+        assert(list.get(0) == 42 && list.get(1) == 7 && list.get(99999) == 99999ULL * 99999ULL);
+        assert(list.indexOf(4) == 2 && list.contains(99999ULL * 99999ULL));
+        list.add(list.get(0));
+        assert(list.get(100000) == 42);
+        list.clear();
+        list.shrinkToFit();
+        assert(list.capacity() == dsa::DefaultGrowthPolicy::MIN_CAPACITY);
+    }
+    {
+        dsa::MmapArrayList<std::uint64_t> list{path};
+        assert(list.isEmpty());
+    }
+    std::remove(path.c_str());
+
+    std::cout << "test persistence success." << std::endl;
+}
+
+void testInvalidFile() {
+    std::cout << "start test invalid file." << std::endl;
+
+    std::string path{temporaryPath("mmap_list_invalid")};
+    std::remove(path.c_str());
+    {
+        dsa::MmapArrayList<std::uint32_t> list{path};
+        list.add(1);
+    }
+    bool thrown{false};
+    try {
+        dsa::MmapArrayList<std::uint64_t> list{path};
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::remove(path.c_str());
+
+    thrown = false;
+    try {
+        dsa::MmapArrayList<int> list{"/nonexistent_dir/list.bin"};
+    } catch (const std::system_error &e) {
+        thrown = e.code() == std::errc::no_such_file_or_directory;
+    }
+    assert(thrown);
+
+    std::cout << "test invalid file success." << std::endl;
+}
+
+void testListInterface() {
+    std::cout << "start test list interface." << std::endl;
+
+    std::string path{temporaryPath("mmap_list_adapter")};
+    std::remove(path.c_str());
+    {
+        dsa::ListAdapter<dsa::MmapArrayList<int>> adapter{path};
+        dsa::List<int> &list{adapter};
+        for (int i = 0; i < 5; ++i) {
+            list.add(0, i);
+        }
+        assert(list.toString([](const int &e) { return std::to_string(e); }) == "[4, 3, 2, 1, 0]");
+    }
+    std::remove(path.c_str());
+
+    std::cout << "test list interface success." << std::endl;
+}
+
+void testMovedFrom() {
+    std::cout << "start test moved from." << std::endl;
+
+    std::string path{temporaryPath("mmap_list_moved")};
+    std::remove(path.c_str());
+    {
+        dsa::MmapArrayList<int> list{path};
+        list.add(1);
+        dsa::MmapArrayList<int> moved{std::move(list)};
+        assert(moved.size() == 1 && moved.get(0) == 1);
+        // 被移动后的对象为空，修改操作抛出 std::system_error
+        assert(list.size() == 0 && list.isEmpty() && list.capacity() == 0);
+        list.clear();
+        bool thrown{false};
+        try {
+            list.add(2);
+        } catch (const std::system_error &) {
+            thrown = true;
+        }
+        assert(thrown && list.isEmpty());
+        list = std::move(moved);
+        assert(list.size() == 1 && moved.capacity() == 0);
+    }
+    std::remove(path.c_str());
+
+    std::cout << "test moved from success." << std::endl;
+}
+
+int main() {
+    testPersistence();
+    testInvalidFile();
+    testListInterface();
+    testMovedFrom();
+    return 0;
+}
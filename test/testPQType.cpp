@@ -7,7 +7,27 @@
  * @Description  :
  */
 #include "PQType.hpp"
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 只能移动的任务，按 priority 出队
+struct Job {
+    int priority;
+    std::unique_ptr<std::string> name;
+
+    Job(int p, std::string n) : priority{p}, name{std::make_unique<std::string>(std::move(n))} {}
+};
+
+struct JobCompare {
+    bool operator()(const Job &lhs, const Job &rhs) const {
+        return lhs.priority < rhs.priority;
+    }
+};
 
 int main() {
     dsa::PQType<int> queue{};
@@ -70,5 +90,75 @@ int main() {
     }
     assert(queue3.isEmpty());
 
+    // 4 叉、8 叉堆与二叉堆的出队顺序一致
+    dsa::PQType<int, 4> queue4{};
+    dsa::PQType<int, 8> queue8{};
+    for (int i = 0; i < 1000; ++i) {
+        queue4.enqueue((i * 7919) % 1009);
+        queue8.enqueue((i * 7919) % 1009);
+    }
+    int last{queue4.dequeue()};
+    assert(last == queue8.dequeue());
+    while (!queue4.isEmpty()) {
+        int cur{queue4.dequeue()};
+        assert(cur <= last && cur == queue8.dequeue());
+        last = cur;
+    }
+    assert(queue8.isEmpty());
+
+    // std::greater 为小顶堆；top 不出队，replaceTop 等价于出队后再入队
+    dsa::PQType<int, 4, std::greater<int>> minQueue{};
+    for (int i = 0; i < 100; ++i) {
+        minQueue.enqueue((i * 37) % 101);
+    }
+    assert(minQueue.size() == 100 && minQueue.top() == 0 && minQueue.size() == 100);
+    assert(minQueue.replaceTop(1000) == 0 && minQueue.top() == 1);
+    assert(minQueue.dequeue() == 1 && minQueue.top() == 2);
+    // 用堆顶自身替换堆顶，队列内容不变
+    dsa::PQType<std::string> words{};
+    words.enqueue("apple");
+    words.enqueue("pear");
+    assert(words.replaceTop(words.top()) == "pear");
+    assert(words.dequeue() == "pear" && words.dequeue() == "apple");
+    minQueue.makeEmpty();
+    bool thrown{false};
+    try {
+        static_cast<void>(minQueue.top());
+    } catch (const dsa::QueueException &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // 只能移动的元素：enqueue(&&)、emplace 和 replaceTop 都不需要拷贝
+    dsa::PQType<Job, 2, JobCompare> jobs{JobCompare{}};
+    jobs.enqueue(Job{3, "three"});
+    jobs.emplace(7, "seven");
+    jobs.emplace(5, "five");
+    assert(jobs.top().priority == 7 && *jobs.top().name == "seven");
+    Job replaced{jobs.replaceTop(Job{1, "one"})};
+    assert(replaced.priority == 7 && jobs.top().priority == 5);
+    dsa::PQType<Job, 2, JobCompare> movedJobs{std::move(jobs)};
+    assert(*movedJobs.dequeue().name == "five" && *movedJobs.dequeue().name == "three");
+    assert(*movedJobs.dequeue().name == "one" && movedJobs.isEmpty());
+
+    // 批量入队：新元素较多时重新建堆，较少时逐个向上调整；批量出队按优先级顺序写出
+    std::vector<int> batch{};
+    for (int i = 0; i < 1000; ++i) {
+        batch.push_back((i * 7919) % 1009);
+    }
+    dsa::PQType<int, 4> batchQueue{};
+    batchQueue.enqueue(500);
+    batchQueue.enqueueAll(batch.begin(), batch.end());
+    batchQueue.enqueueAll(batch.begin(), batch.begin() + 10);
+    assert(batchQueue.size() == 1011);
+    std::vector<int> drained{};
+    batchQueue.dequeueUpTo(11, std::back_inserter(drained));
+    assert(drained.size() == 11 && drained.front() == 1008 && std::is_sorted(drained.rbegin(), drained.rend()));
+    int outArray[2000]{};
+    int *end{batchQueue.dequeueUpTo(2000, outArray)};
+    assert(end - outArray == 1000 && batchQueue.isEmpty() && outArray[0] <= drained.back());
+    assert(std::is_sorted(std::make_reverse_iterator(end), std::make_reverse_iterator(outArray)));
+    assert(batchQueue.dequeueUpTo(5, outArray) == outArray);
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,121 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 14:22:18
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 14:22:18
+ * @FilePath     : /test/testParallel.cpp
+ * @Description  :
+ */
+
+#include "ArrayList.hpp"
+#include "parallel.hpp"
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+void testThreadPool() {
+    std::cout << "start test thread pool." << std::endl;
+
+    dsa::ThreadPool pool{4};
+    assert(pool.threadCount() == 4);
+    std::atomic<int> sum{0};
+    pool.parallelFor(1000, 7, [&sum](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            sum.fetch_add(static_cast<int>(i), std::memory_order_relaxed);
+        }
+    });
+    assert(sum.load() == 999 * 1000 / 2);
+
+    // 任务内部嵌套调用 parallelFor 不会死锁
+    std::atomic<int> count{0};
+    pool.parallelFor(16, 1, [&pool, &count](std::size_t, std::size_t) {
+        pool.parallelFor(100, 10, [&count](std::size_t begin, std::size_t end) {
+            count.fetch_add(static_cast<int>(end - begin), std::memory_order_relaxed);
+        });
+    });
+    assert(count.load() == 1600);
+
+    bool thrown{false};
+    try {
+        pool.parallelFor(100, 1, [](std::size_t begin, std::size_t) {
+            if (begin == 42) {
+                throw std::runtime_error{"chunk 42"};
+            }
+        });
+    } catch (const std::runtime_error &e) {
+        thrown = std::string{e.what()} == "chunk 42";
+    }
+    assert(thrown);
+
+    std::cout << "test thread pool success." << std::endl;
+}
+
+void testAlgorithms() {
+    std::cout << "start test algorithms." << std::endl;
+
+    dsa::ThreadPool pool{4};
+    constexpr std::size_t size{200000};
+    dsa::ArrayList<long> list{};
+    for (std::size_t i = 0; i < size; ++i) {
+        list.add(static_cast<long>(i));
+    }
+    // cutoff 为 0 时总是并行执行
+    dsa::parallel::forEach(list, [](long &e) { e *= 2; }, 0, pool);
+    assert(list.get(size - 1) == static_cast<long>(size - 1) * 2);
+    assert(dsa::parallel::reduce(list, 0L, [](long a, long b) { return a + b; }, 0, pool) == static_cast<long>(size - 1) * size);
+
+    dsa::ArrayList<double> halves{};
+    for (std::size_t i = 0; i < size; ++i) {
+        halves.add(0.0);
+    }
+    dsa::parallel::transform(list, halves, [](long e) { return e / 4.0; }, 0, pool);
+    assert(halves.get(10) == 5.0);
+    bool thrown{false};
+    try {
+        dsa::parallel::transform(list.span(), halves.span().first(10), [](long e) { return e / 4.0; }, 0, pool);
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // 拼接字符串不满足交换律，结果仍需保持元素顺序
+    dsa::ArrayList<std::string> words{};
+    for (std::size_t i = 0; i < 10000; ++i) {
+        words.add(std::to_string(i % 10));
+    }
+    std::string joined{dsa::parallel::reduce(words, std::string{}, [](std::string a, const std::string &b) { return a += b; }, 0, pool)};
+    assert(joined.size() == 10000 && joined.compare(0, 12, "012345678901") == 0);
+
+    // R 与元素类型含义不同：统计正数个数，串行和并行结果一致
+    dsa::ArrayList<int> fives{};
+    for (std::size_t i = 0; i < 100000; ++i) {
+        fives.add(i % 4 == 0 ? -5 : 5);
+    }
+    auto countPositive{[](long count, int e) { return count + (e > 0); }};
+    auto sum{[](long a, long b) { return a + b; }};
+    assert(dsa::parallel::aggregate(fives, 0L, countPositive, sum, fives.size() + 1, pool) == 75000);
+    assert(dsa::parallel::aggregate(fives, 0L, countPositive, sum, 0, pool) == 75000);
+    std::size_t totalLength{dsa::parallel::aggregate(
+        words, std::size_t{0}, [](std::size_t length, const std::string &e) { return length + e.size(); }, std::plus<std::size_t>{}, 0, pool)};
+    assert(totalLength == 10000);
+
+    list.set(150000, -1);
+    list.set(190000, -1);
+    assert(dsa::parallel::indexOf(list, -1L, 0, pool) == 150000);
+    assert(dsa::parallel::indexOf(list, -2L, 0, pool) == dsa::parallel::npos);
+    assert(dsa::parallel::indexOf(list, -1L) == 150000);
+    assert(dsa::parallel::indexOf(words, std::string{"7"}, 0, pool) == 7);
+    assert(dsa::parallel::indexOfIf(list, [](long e) { return e > 100000; }, 0, pool) == 50001);
+    assert(dsa::parallel::indexOfIf(list.span().subspan(0, 100), [](long e) { return e < 0; }) == dsa::parallel::npos);
+
+    std::cout << "test algorithms success." << std::endl;
+}
+
+int main() {
+    testThreadPool();
+    testAlgorithms();
+    return 0;
+}
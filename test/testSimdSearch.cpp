@@ -0,0 +1,101 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 16:20:44
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-18 16:20:44
+ * @FilePath     : /test/testSimdSearch.cpp
+ * @Description  :
+ */
+#include "simd_search.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace {
+
+template <typename T>
+std::size_t referenceFindLast(const std::vector<T> &v, const T &value) {
+    for (std::size_t i{v.size()}; i > 0; --i) {
+        if (v[i - 1] == value) {
+            return i - 1;
+        }
+    }
+    return v.size();
+}
+
+template <typename T>
+void checkAgainstReference(const std::vector<T> &v, const T &value) {
+    auto first{static_cast<std::size_t>(std::find(v.begin(), v.end(), value) - v.begin())};
+    assert(dsa::simd::findFirst(v.data(), v.size(), value) == first);
+    assert(dsa::simd::findLast(v.data(), v.size(), value) == referenceFindLast(v, value));
+    assert(dsa::simd::count(v.data(), v.size(), value) == static_cast<std::size_t>(std::count(v.begin(), v.end(), value)));
+}
+
+template <typename T>
+void testType() {
+    // 覆盖空序列、不足一个向量、跨越展开步长的各种长度以及各个位置上的命中
+    for (std::size_t size : {0, 1, 3, 7, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129, 300, 1000}) {
+        std::vector<T> v(size);
+        for (std::size_t i{0}; i < size; ++i) {
+            v[i] = static_cast<T>(i % 97 + 1);
+        }
+        checkAgainstReference(v, static_cast<T>(0));
+        checkAgainstReference(v, static_cast<T>(1));
+        checkAgainstReference(v, static_cast<T>(50));
+        for (std::size_t pos{0}; pos < size; pos += 1 + pos / 4) {
+            T old{v[pos]};
+            v[pos] = std::numeric_limits<T>::max();
+            checkAgainstReference(v, std::numeric_limits<T>::max());
+            v[pos] = old;
+        }
+    }
+}
+
+void testFloatingSemantics() {
+    std::vector<double> v(40, 1.0);
+    v[5] = -0.0;
+    v[20] = std::nan("");
+    // -0.0 == 0.0，NaN 与任何值都不相等
+    assert(dsa::simd::findFirst(v.data(), v.size(), 0.0) == 5);
+    assert(dsa::simd::findFirst(v.data(), v.size(), std::nan("")) == v.size());
+    std::vector<float> f(40, 1.0F);
+    f[33] = -0.0F;
+    assert(dsa::simd::findLast(f.data(), f.size(), 0.0F) == 33);
+}
+
+void testAllTypes() {
+    testType<char>();
+    testType<std::int8_t>();
+    testType<std::uint8_t>();
+    testType<std::int16_t>();
+    testType<std::uint16_t>();
+    testType<int>();
+    testType<unsigned>();
+    testType<long long>();
+    testType<std::uint64_t>();
+    testType<float>();
+    testType<double>();
+    testFloatingSemantics();
+}
+
+} // namespace
+
+int main() {
+    static_assert(dsa::simd::is_searchable_v<int>);
+    static_assert(dsa::simd::is_searchable_v<double>);
+    static_assert(!dsa::simd::is_searchable_v<long double>);
+    static_assert(!dsa::simd::is_searchable_v<std::vector<int>>);
+
+    for (auto instructionSet : {dsa::simd::InstructionSet::SCALAR, dsa::simd::InstructionSet::SSE2, dsa::simd::InstructionSet::AVX2}) {
+        auto actual{dsa::simd::setInstructionSet(instructionSet)};
+        std::cout << "start test simd search with instruction set " << static_cast<int>(actual) << "." << std::endl;
+        testAllTypes();
+    }
+    dsa::simd::setInstructionSet(dsa::simd::detectInstructionSet());
+    std::cout << "test simd search success." << std::endl;
+    return 0;
+}
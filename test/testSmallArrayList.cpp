@@ -0,0 +1,291 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 19:20:41
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-20 14:36:52
+ * @FilePath     : /test/testSmallArrayList.cpp
+ * @Description  :
+ */
+
+#include "ListAdapter.hpp"
+#include "SmallArrayList.hpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+
+// 统计向上游申请内存的次数，用来确认内联阶段没有堆分配
+class CountingResource final : public std::pmr::memory_resource {
+public:
+    std::size_t allocations{0};
+    std::size_t outstanding{0};
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        ++outstanding;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+        --outstanding;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+};
+
+void testInlineStorage() {
+    std::cout << "start test inline storage." << std::endl;
+
+    CountingResource resource{};
+    {
+        dsa::pmr::SmallArrayList<int, 8> list{&resource};
+        for (int i = 0; i < 8; ++i) {
+            list.add(i);
+        }
+        list.add(0, -1);
+        assert(resource.allocations == 1);
+        assert(!list.isInline());
+        assert(list.size() == 9 && list.get(0) == -1 && list.get(8) == 7);
+        list.remove(0);
+        list.shrinkToFit();
+        assert(list.isInline() && list.capacity() == 8);
+        assert(resource.outstanding == 0);
+        for (int i = 0; i < 8; ++i) {
+            assert(list.get(i) == i);
+        }
+    }
+    {
+        dsa::pmr::SmallArrayList<int, 8> list{&resource};
+        resource.allocations = 0;
+        for (int i = 0; i < 8; ++i) {
+            list.add(0, i);
+        }
+        assert(resource.allocations == 0);
+        assert(list.isInline() && list.indexOf(7) == 0 && list.indexOf(0) == 7);
+        assert(list.contains(3) && !list.contains(8));
+    }
+    assert(resource.outstanding == 0);
+
+    std::cout << "test inline storage success." << std::endl;
+}
+
+void testSpillAndShrink() {
+    std::cout << "start test spill and shrink." << std::endl;
+
+    dsa::SmallArrayList<std::string, 4> list{};
+    for (int i = 0; i < 100; ++i) {
+        list.add(std::to_string(i));
+    }
+    assert(!list.isInline() && list.size() == 100);
+    // 参数引用集合自身元素，扩容时也要保证正确
+    list.add(list.get(99));
+    assert(list.get(100) == "99");
+    while (list.size() > 3) {
+        list.remove(list.size() - 1);
+    }
+    assert(list.toString([](const std::string &e) { return e; }) == "[0, 1, 2]");
+    list.shrinkToFit();
+    assert(list.isInline());
+    list.reserve(50);
+    assert(!list.isInline() && list.capacity() >= 50);
+    assert(list.get(2) == "2");
+    assert(list.set(0, std::string{"zero"}) == "0");
+    list.emplace(1, 3, 'x');
+    list.emplaceBack("end");
+    assert(list.toString([](const std::string &e) { return e; }) == "[zero, xxx, 1, 2, end]");
+
+    std::cout << "test spill and shrink success." << std::endl;
+}
+
+void testMove() {
+    std::cout << "start test move." << std::endl;
+
+    dsa::SmallArrayList<std::string, 4> small{};
+    small.add("a");
+    small.add("b");
+    dsa::SmallArrayList<std::string, 4> movedSmall{std::move(small)};
+    assert(movedSmall.isInline() && movedSmall.size() == 2 && movedSmall.get(1) == "b");
+    assert(small.isEmpty());
+
+    dsa::SmallArrayList<std::string, 4> large{};
+    for (int i = 0; i < 10; ++i) {
+        large.add(std::to_string(i));
+    }
+    const std::string *data{large.data()};
+    dsa::SmallArrayList<std::string, 4> movedLarge{std::move(large)};
+    // 堆内存直接接管，元素没有被搬移
+    assert(movedLarge.data() == data && movedLarge.size() == 10);
+    assert(large.isInline() && large.isEmpty());
+
+    movedSmall = std::move(movedLarge);
+    assert(movedSmall.data() == data && movedSmall.size() == 10);
+    movedLarge.add("c");
+    movedSmall = std::move(movedLarge);
+    assert(movedSmall.isInline() && movedSmall.size() == 1 && movedSmall.get(0) == "c");
+
+    std::cout << "test move success." << std::endl;
+}
+
+void testListInterface() {
+    std::cout << "start test list interface." << std::endl;
+
+    dsa::ListAdapter<dsa::SmallArrayList<int>> adapter{};
+    dsa::List<int> &list{adapter};
+    for (int i = 0; i < 20; ++i) {
+        list.add(i);
+    }
+    assert(list.size() == 20 && list.get(19) == 19);
+    assert(list.remove(0) == 0 && list.indexOf(19) == 18);
+    bool thrown{false};
+    try {
+        static_cast<void>(list.get(19));
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    dsa::SmallArrayList<int> &impl{adapter.getList()};
+    std::sort(impl.rbegin(), impl.rend());
+    assert(impl.get(0) == 19 && *impl.begin() == 19);
+    dsa::Span<const int> span{static_cast<const dsa::SmallArrayList<int> &>(impl).span()};
+    assert(span.size() == 19 && span[18] == 1);
+
+    std::cout << "test list interface success." << std::endl;
+}
+
+// 移动构造未声明 noexcept，剩余构造次数耗尽时抛出异常
+class FragileObject {
+public:
+    explicit FragileObject(int value) :
+        __value{value} {
+        ++liveCount;
+    }
+    FragileObject(const FragileObject &rhs) :
+        __value{rhs.__value} {
+        __consumeBudget();
+        ++liveCount;
+    }
+    FragileObject(FragileObject &&rhs) :
+        __value{rhs.__value} {
+        __consumeBudget();
+        rhs.__value = -1;
+        ++liveCount;
+    }
+    FragileObject &operator=(const FragileObject &) = default;
+    FragileObject &operator=(FragileObject &&) = default;
+    ~FragileObject() {
+        --liveCount;
+    }
+
+    int value() const {
+        return __value;
+    }
+
+    inline static int liveCount{0};
+    // 小于 0 表示不限制构造次数
+    inline static int constructBudget{-1};
+
+private:
+    static void __consumeBudget() {
+        if (constructBudget == 0) {
+            throw std::runtime_error{"construct budget exhausted"};
+        }
+        if (constructBudget > 0) {
+            --constructBudget;
+        }
+    }
+
+    int __value;
+};
+
+void testExceptionSafety() {
+    std::cout << "start test exception safety." << std::endl;
+
+    {
+        dsa::SmallArrayList<FragileObject, 4> list{};
+        auto holds{[&list](int count) {
+            if (list.size() != static_cast<std::size_t>(count) || FragileObject::liveCount != count) {
+                return false;
+            }
+            for (int i = 0; i < count; ++i) {
+                if (list.get(i).value() != i) {
+                    return false;
+                }
+            }
+            return true;
+        }};
+        auto throws{[](auto &&operation) {
+            bool thrown{false};
+            try {
+                operation();
+            } catch (const std::runtime_error &) {
+                thrown = true;
+            }
+            FragileObject::constructBudget = -1;
+            return thrown;
+        }};
+        for (int i = 0; i < 4; ++i) {
+            list.emplaceBack(i);
+        }
+
+        // 从内联缓冲区搬到堆内存时失败，元素仍留在内联缓冲区
+        FragileObject::constructBudget = 2;
+        assert(throws([&list]() { list.emplace(1, 100); }));
+        assert(list.isInline() && holds(4));
+
+        for (int i = 4; i < 8; ++i) {
+            list.emplaceBack(i);
+        }
+        while (list.size() > 3) {
+            static_cast<void>(list.remove(list.size() - 1));
+        }
+        // 从堆内存搬回内联缓冲区时失败，元素仍留在堆内存
+        FragileObject::constructBudget = 1;
+        assert(throws([&list]() { list.shrinkToFit(); }));
+        assert(!list.isInline() && holds(3));
+        list.shrinkToFit();
+        assert(list.isInline() && holds(3));
+    }
+    assert(FragileObject::liveCount == 0);
+
+    std::cout << "test exception safety success." << std::endl;
+}
+
+void testBoundsCheck() {
+    std::cout << "start test bounds check." << std::endl;
+
+    dsa::SmallArrayList<int, 4, std::allocator<int>, dsa::DefaultGrowthPolicy, dsa::BoundsUnchecked> unchecked{};
+    dsa::pmr::SmallArrayList<int, 4, dsa::DefaultGrowthPolicy, dsa::BoundsChecked> checked{};
+    for (int i = 0; i < 10; ++i) {
+        unchecked.add(i);
+        checked.add(i);
+    }
+    unchecked[0] = 10;
+    assert(unchecked.get(0) == 10 && checked[9] == 9);
+
+    bool thrown{false};
+    try {
+        static_cast<void>(checked.get(10));
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "test bounds check success." << std::endl;
+}
+
+int main() {
+    testInlineStorage();
+    testSpillAndShrink();
+    testMove();
+    testListInterface();
+    testExceptionSafety();
+    testBoundsCheck();
+    return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 22:58:03
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-21 10:26:18
+ * @FilePath     : /test/testSnapshot.cpp
+ * @Description  :
+ */
+
+#include "ArrayList.hpp"
+#include "MmapArrayList.hpp"
+#include "SmallArrayList.hpp"
+#include "mapped_file.hpp"
+#include "snapshot.hpp"
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// 只提供 add 的集合
+template <typename T>
+struct AppendOnly {
+    using value_type = T;
+
+    void add(T &&element) {
+        elements.push_back(std::move(element));
+    }
+
+    std::vector<T> elements;
+};
+
+void testRawSnapshot() {
+    std::cout << "start test raw snapshot." << std::endl;
+
+    std::string path{"/tmp/dsa_snapshot_" + std::to_string(::getpid()) + ".bin"};
+    dsa::ArrayList<std::uint64_t> list{};
+    for (std::uint64_t i = 0; i < 100000; ++i) {
+        list.add(i * 3);
+    }
+    int fd{::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)};
+    assert(fd != -1);
+    dsa::snapshot::writeSnapshot(fd, list.span());
+    ::close(fd);
+
+    {
+        // 映射整个文件后零拷贝访问
+        dsa::MappedFile file{path, 1};
+        auto view{dsa::snapshot::viewSnapshot<std::uint64_t>(file.data(), file.size())};
+        assert(view.size() == 100000);
+        assert(static_cast<const void *>(view.data()) == static_cast<const unsigned char *>(file.data()) + sizeof(dsa::snapshot::SnapshotHeader));
+        for (std::size_t i = 0; i < view.size(); ++i) {
+            assert(view[i] == i * 3);
+        }
+
+        bool thrown{false};
+        try {
+            dsa::snapshot::viewSnapshot<std::uint32_t>(file.data(), file.size());
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        assert(thrown);
+        thrown = false;
+        try {
+            dsa::snapshot::viewSnapshot<std::uint64_t>(file.data(), file.size() - 1);
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    std::ifstream input{path, std::ios::binary};
+    dsa::ArrayList<std::uint64_t> loaded{};
+    assert(dsa::snapshot::readSnapshot(input, loaded) == 100000);
+    assert(loaded.size() == 100000 && loaded.get(99999) == 99999 * 3);
+    std::remove(path.c_str());
+
+    // 各连续集合走批量读取，只提供 add 的集合逐个读取
+    std::stringstream stream{};
+    dsa::snapshot::writeSnapshot(stream, list.span());
+    std::string bytes{stream.str()};
+    {
+        std::stringstream source{bytes};
+        dsa::SmallArrayList<std::uint64_t, 8> small{};
+        assert(dsa::snapshot::readSnapshot(source, small) == 100000);
+        assert(small.size() == 100000 && small.get(54321) == 54321 * 3);
+    }
+    {
+        std::string mmapPath{"/tmp/dsa_snapshot_mmap_" + std::to_string(::getpid()) + ".bin"};
+        {
+            std::stringstream source{bytes};
+            dsa::MmapArrayList<std::uint64_t> mapped{mmapPath};
+            assert(dsa::snapshot::readSnapshot(source, mapped) == 100000);
+            assert(mapped.size() == 100000 && mapped.get(99999) == 99999 * 3);
+        }
+        std::remove(mmapPath.c_str());
+    }
+    {
+        std::stringstream source{bytes};
+        AppendOnly<std::uint64_t> appendOnly{};
+        assert(dsa::snapshot::readSnapshot(source, appendOnly) == 100000);
+        assert(appendOnly.elements.size() == 100000 && appendOnly.elements[12345] == 12345 * 3);
+    }
+
+    // 数量字段超出剩余字节时不预留内存，直接报告截断
+    std::uint64_t hugeCount{std::uint64_t{1} << 40};
+    std::memcpy(bytes.data() + 24, &hugeCount, sizeof(hugeCount));
+    std::stringstream truncated{bytes};
+    bool thrown{false};
+    try {
+        dsa::ArrayList<std::uint64_t> target{};
+        dsa::snapshot::readSnapshot(truncated, target);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "test raw snapshot success." << std::endl;
+}
+
+struct Point {
+    std::string name;
+    int x;
+    int y;
+};
+
+struct PointCodec {
+    void encode(std::ostream &os, const Point &point) const {
+        dsa::snapshot::SnapshotCodec<std::string>{}.encode(os, point.name);
+        os.write(reinterpret_cast<const char *>(&point.x), sizeof(point.x));
+        os.write(reinterpret_cast<const char *>(&point.y), sizeof(point.y));
+    }
+
+    Point decode(std::istream &is) const {
+        Point point{dsa::snapshot::SnapshotCodec<std::string>{}.decode(is), 0, 0};
+        is.read(reinterpret_cast<char *>(&point.x), sizeof(point.x));
+        is.read(reinterpret_cast<char *>(&point.y), sizeof(point.y));
+        return point;
+    }
+};
+
+void testEncodedSnapshot() {
+    std::cout << "start test encoded snapshot." << std::endl;
+
+    dsa::ArrayList<std::string> strings{};
+    strings.add("");
+    strings.add("hello");
+    strings.add(std::string(1000, 'x'));
+    std::stringstream stream{};
+    dsa::snapshot::writeSnapshot(stream, strings.span());
+    dsa::ArrayList<std::string> loadedStrings{};
+    assert(dsa::snapshot::readSnapshot(stream, loadedStrings) == 3);
+    assert(loadedStrings.get(0).empty() && loadedStrings.get(1) == "hello" && loadedStrings.get(2) == std::string(1000, 'x'));
+
+    // 跨多个读取块的字符串
+    dsa::ArrayList<std::string> large{};
+    large.add(std::string(200000, 'y'));
+    std::stringstream largeStream{};
+    dsa::snapshot::writeSnapshot(largeStream, large.span());
+    dsa::ArrayList<std::string> loadedLarge{};
+    dsa::snapshot::readSnapshot(largeStream, loadedLarge);
+    assert(loadedLarge.get(0) == std::string(200000, 'y'));
+
+    // 损坏的长度字段：第二个字符串的长度位于 32 字节头部和第一个字符串的 8 字节长度之后
+    std::string corrupted{};
+    {
+        std::stringstream source{};
+        dsa::snapshot::writeSnapshot(source, strings.span());
+        corrupted = source.str();
+    }
+    std::uint64_t hugeLength{std::uint64_t{1} << 40};
+    std::memcpy(corrupted.data() + 40, &hugeLength, sizeof(hugeLength));
+    std::stringstream corruptedStream{corrupted};
+    bool corruptedThrown{false};
+    try {
+        dsa::ArrayList<std::string> target{};
+        dsa::snapshot::readSnapshot(corruptedStream, target);
+    } catch (const std::runtime_error &) {
+        corruptedThrown = true;
+    }
+    assert(corruptedThrown);
+
+    dsa::ArrayList<Point> points{};
+    points.add(Point{"a", 1, 2});
+    points.add(Point{"b", -3, 4});
+    std::stringstream pointStream{};
+    dsa::snapshot::writeSnapshot(pointStream, points.span(), PointCodec{});
+    dsa::ArrayList<Point> loadedPoints{};
+    dsa::snapshot::readSnapshot(pointStream, loadedPoints, PointCodec{});
+    assert(loadedPoints.size() == 2 && loadedPoints.get(1).name == "b" && loadedPoints.get(1).x == -3);
+
+    // 截断的快照
+    std::stringstream again{};
+    dsa::snapshot::writeSnapshot(again, points.span(), PointCodec{});
+    std::stringstream broken{again.str().substr(0, again.str().size() - 2)};
+    bool thrown{false};
+    try {
+        dsa::ArrayList<Point> target{};
+        dsa::snapshot::readSnapshot(broken, target, PointCodec{});
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "test encoded snapshot success." << std::endl;
+}
+
+int main() {
+    testRawSnapshot();
+    testEncodedSnapshot();
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-19 10:41:27
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-19 10:41:27
+ * @FilePath     : /test/testSoAList.cpp
+ * @Description  :
+ */
+
+#include "SoAList.hpp"
+#include <cassert>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+void testRow() {
+    std::cout << "start test row." << std::endl;
+
+    dsa::SoAList<int, std::string, double> list{};
+    assert(list.isEmpty());
+    for (int i = 0; i < 100; ++i) {
+        list.add(i, std::to_string(i), i * 0.5);
+    }
+    assert(list.size() == 100 && list.capacity() >= 100);
+    auto [id, name, weight] = list.get(42);
+    assert(id == 42 && name == "42" && weight == 21.0);
+
+    // row 返回的引用可以直接修改集合中的字段
+    std::get<1>(list.row(42)) = "forty-two";
+    assert(std::get<1>(list.get(42)) == "forty-two");
+    list.row(0) = std::make_tuple(-1, std::string{"zero"}, 0.0);
+    assert(std::get<0>(list.get(0)) == -1 && std::get<1>(list.get(0)) == "zero");
+
+    list.insert(0, 1000, std::string{"head"}, 1.0);
+    list.insert(50, 2000, std::string{"middle"}, 2.0);
+    assert(list.size() == 102);
+    assert(std::get<1>(list.get(0)) == "head" && std::get<1>(list.get(50)) == "middle");
+    assert(std::get<0>(list.get(1)) == -1 && std::get<0>(list.get(51)) == 49);
+
+    auto removed{list.remove(50)};
+    assert(std::get<0>(removed) == 2000 && std::get<1>(removed) == "middle");
+    assert(std::get<0>(list.get(50)) == 49);
+
+    bool thrown{false};
+    try {
+        static_cast<void>(list.get(list.size()));
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "test row success." << std::endl;
+}
+
+void testColumn() {
+    std::cout << "start test column." << std::endl;
+
+    dsa::SoAList<int, std::string> list{};
+    for (int i = 0; i < 1000; ++i) {
+        list.add(i, std::to_string(i));
+    }
+    dsa::Span<const int> ids{std::as_const(list).column<0>()};
+    assert(ids.size() == 1000 && ids[999] == 999);
+    assert(std::accumulate(ids.begin(), ids.end(), 0L) == 999L * 1000 / 2);
+    for (int &id : list.column<0>()) {
+        id *= 2;
+    }
+    assert(std::get<0>(list.get(10)) == 20 && list.column<1>()[10] == "10");
+
+    // 删除所有 id 能被 4 整除的行，剩余行保持顺序
+    assert(list.removeIf([](const auto &row) { return std::get<0>(row) % 4 == 0; }) == 500);
+    assert(list.size() == 500);
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        auto [id, name] = list.get(i);
+        assert(id == static_cast<int>(i) * 4 + 2 && name == std::to_string(i * 2 + 1));
+    }
+    std::size_t capacity{list.capacity()};
+    while (list.size() > 10) {
+        list.remove(list.size() - 1);
+    }
+    assert(list.capacity() < capacity);
+    list.shrinkToFit();
+    assert(list.capacity() >= list.size());
+
+    dsa::SoAList<int, std::string> moved{std::move(list)};
+    assert(moved.size() == 10 && list.isEmpty());
+    list = std::move(moved);
+    assert(list.size() == 10 && list.column<1>()[9] == "19");
+    list.clear();
+    assert(list.isEmpty() && list.column<0>().empty());
+
+    std::cout << "test column success." << std::endl;
+}
+
+int main() {
+    testRow();
+    testColumn();
+    return 0;
+}
@@ -1,8 +1,29 @@
 #include "sort.hpp"
 #include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <vector>
 
+// 只能移动的元素，记录比较次数
+struct CountedKey {
+    static inline std::size_t comparisons{0};
+
+    std::unique_ptr<int> key;
+
+    explicit CountedKey(int k) : key{std::make_unique<int>(k)} {}
+
+    bool operator<(const CountedKey &other) const {
+        ++comparisons;
+        return *key < *other.key;
+    }
+
+    bool operator>(const CountedKey &other) const { return other < *this; }
+};
+
 template <typename RandomAccessIterator>
 bool isSorted(RandomAccessIterator begin, RandomAccessIterator end) {
     while (begin != end && begin + 1 != end) {
@@ -65,4 +86,54 @@ int main() {
         v.push_back(3);
         dsa::insertionSort(std::begin(v), std::end(v));
     }
+    {
+        // 多叉堆排序，包括迭代器形式和非 vector 容器
+        std::vector<int> v{};
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back((i * 7919) % 1009);
+        }
+        std::vector<int> v3{v};
+        std::vector<int> v4{v};
+        std::deque<int> d8{v.begin(), v.end()};
+        dsa::heapSort<3>(v3);
+        dsa::heapSort<4>(std::begin(v4), std::end(v4));
+        dsa::heapSort<8>(std::begin(d8), std::end(d8));
+        assert(isSorted(std::begin(v3), std::end(v3)));
+        assert(isSorted(std::begin(v4), std::end(v4)));
+        assert(isSorted(std::begin(d8), std::end(d8)));
+        testSort(v, [](auto begin, auto end) { dsa::heapSort<16>(begin, end); });
+        // 按 std::greater 排序得到降序
+        dsa::heapSort<4>(v4, std::greater<int>{});
+        assert(isSorted(v4.rbegin(), v4.rend()));
+        v.resize(1);
+        dsa::heapSort<4>(std::begin(v), std::end(v));
+    }
+    {
+        // 空位调整只移动元素，不需要拷贝；自底向上的堆排序比较次数约为 n * log2(n)
+        const int n{1 << 12};
+        std::vector<CountedKey> v{};
+        for (int i = 0; i < n; ++i) {
+            v.emplace_back((i * 7919) % 4099);
+        }
+        CountedKey::comparisons = 0;
+        testSort(v, [](auto begin, auto end) { dsa::heapSort(begin, end); });
+        assert(CountedKey::comparisons < static_cast<std::size_t>(1.2 * n * std::log2(n)));
+    }
+    {
+        // 递归、迭代以及自底向上的调整结果一致
+        std::vector<int> heap{50, 40, 30, 20, 10, 25, 5, 15};
+        std::vector<int> recursive{heap};
+        std::vector<int> bottomUp{heap};
+        heap[0] = recursive[0] = bottomUp[0] = 1;
+        dsa::reshapeDown(heap, 0, heap.size() - 1);
+        dsa::recursion::reshapeDown(recursive, 0, recursive.size() - 1);
+        dsa::reshapeDownBottomUp(bottomUp, 0, bottomUp.size() - 1);
+        assert(heap == recursive && heap == bottomUp);
+        assert((heap == std::vector<int>{40, 20, 30, 15, 10, 25, 5, 1}));
+        heap.push_back(45);
+        recursive.push_back(45);
+        dsa::reshapeUp(heap, 0, heap.size() - 1);
+        dsa::recursion::reshapeUp(recursive, 0, recursive.size() - 1);
+        assert(heap == recursive && heap[0] == 45 && heap[1] == 40);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,186 @@
+/*
+ * @Author       : sphc
+ * @Date         : 2026-10-18 21:02:36
+ * @LastEditors  : sphc
+ * @LastEditTime : 2026-10-21 11:20:07
+ * @FilePath     : /test/testTieredList.cpp
+ * @Description  :
+ */
+
+#include "ListAdapter.hpp"
+#include "TieredList.hpp"
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// 与 std::vector 对照，随机位置插入/删除后内容保持一致
+template <typename ElementType, typename Generator>
+void checkAgainstVector(Generator generate, int operations) {
+    dsa::TieredList<ElementType> list{};
+    std::vector<ElementType> expected{};
+    std::mt19937 engine{20261018};
+    for (int i = 0; i < operations; ++i) {
+        bool insert{expected.empty() || engine() % 3 != 0};
+        if (insert) {
+            std::size_t index{engine() % (expected.size() + 1)};
+            ElementType value{generate(i)};
+            list.add(index, value);
+            expected.insert(expected.begin() + index, value);
+        } else {
+            std::size_t index{engine() % expected.size()};
+            assert(list.remove(index) == expected[index]);
+            expected.erase(expected.begin() + index);
+        }
+    }
+    assert(list.size() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        assert(list.get(i) == expected[i]);
+    }
+    while (!expected.empty()) {
+        std::size_t index{engine() % expected.size()};
+        assert(list.remove(index) == expected[index]);
+        expected.erase(expected.begin() + index);
+    }
+    assert(list.isEmpty() && list.blockCapacity() == 16);
+}
+
+void testRandomEdit() {
+    std::cout << "start test random edit." << std::endl;
+
+    checkAgainstVector<int>([](int i) { return i; }, 20000);
+    checkAgainstVector<std::string>([](int i) { return std::to_string(i) + std::string(20, 'x'); }, 5000);
+
+    std::cout << "test random edit success." << std::endl;
+}
+
+void testBlockCapacity() {
+    std::cout << "start test block capacity." << std::endl;
+
+    dsa::TieredList<int> list{};
+    for (int i = 0; i < 100000; ++i) {
+        list.add(i);
+    }
+    // B 保持在 √n 附近
+    assert(list.blockCapacity() * list.blockCapacity() >= 100000 / 4);
+    assert(list.blockCapacity() * list.blockCapacity() <= 100000 * 4);
+    for (int i = 0; i < 100000; ++i) {
+        assert(list.get(i) == i);
+    }
+    list.add(0, -1);
+    list.add(50000, -2);
+    assert(list.get(0) == -1 && list.get(50000) == -2 && list.get(100001) == 99999);
+    assert(list.indexOf(-2) == 50000 && list.contains(99999) && !list.contains(100000));
+    assert(list.set(0, 7) == -1 && list.get(0) == 7);
+    list.emplace(1, 8);
+    assert(list.get(1) == 8);
+
+    dsa::TieredList<int> moved{std::move(list)};
+    assert(moved.size() == 100003 && list.isEmpty());
+    list = std::move(moved);
+    assert(list.size() == 100003 && moved.isEmpty());
+    list.clear();
+    assert(list.isEmpty());
+
+    std::cout << "test block capacity success." << std::endl;
+}
+
+void testListInterface() {
+    std::cout << "start test list interface." << std::endl;
+
+    dsa::ListAdapter<dsa::TieredList<int>> adapter{};
+    dsa::List<int> &list{adapter};
+    for (int i = 0; i < 5; ++i) {
+        list.add(0, i);
+    }
+    assert(list.toString([](const int &e) { return std::to_string(e); }) == "[4, 3, 2, 1, 0]");
+    bool thrown{false};
+    try {
+        list.add(6, 0);
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "test list interface success." << std::endl;
+}
+
+// 剩余可分配次数，小于 0 表示不限制；rebind 后的分配器共享计数
+int allocationsLeft{-1};
+// 尚未释放的分配次数，用来检查泄漏
+int outstandingAllocations{0};
+
+template <typename T>
+class LimitedAllocator {
+public:
+    using value_type = T;
+
+    LimitedAllocator() = default;
+    template <typename U>
+    LimitedAllocator(const LimitedAllocator<U> &) noexcept {
+    }
+
+    T *allocate(std::size_t n) {
+        if (allocationsLeft == 0) {
+            throw std::bad_alloc{};
+        }
+        if (allocationsLeft > 0) {
+            --allocationsLeft;
+        }
+        ++outstandingAllocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept {
+        --outstandingAllocations;
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const LimitedAllocator<U> &) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const LimitedAllocator<U> &) const noexcept {
+        return false;
+    }
+};
+
+void testAllocationFailure() {
+    std::cout << "start test allocation failure." << std::endl;
+
+    // 依次让第 budget 次分配失败，覆盖分配新块、扩充块数组和重建块容量几种情况，失败后集合保持有效且不能泄漏已分配的块
+    for (int budget = 0; budget < 120; ++budget) {
+        {
+            dsa::TieredList<int, LimitedAllocator<int>> list{};
+            int added{0};
+            allocationsLeft = budget;
+            try {
+                for (; added < 2000; ++added) {
+                    list.add(added);
+                }
+            } catch (const std::bad_alloc &) {
+            }
+            allocationsLeft = -1;
+            assert(list.size() == static_cast<std::size_t>(added));
+            for (int i = 0; i < added; ++i) {
+                assert(list.get(i) == i);
+            }
+        }
+        assert(outstandingAllocations == 0);
+    }
+
+    std::cout << "test allocation failure success." << std::endl;
+}
+
+int main() {
+    testRandomEdit();
+    testBlockCapacity();
+    testListInterface();
+    testAllocationFailure();
+    return 0;
+}